@@ -0,0 +1,167 @@
+/**
+ * @file IthacaBenchmark.cpp
+ * @brief Headless offline render benchmark of IthacaPluginProcessor::processBlock()
+ *
+ * Renders a fixed, generated MIDI performance (chords, pedalled arpeggios,
+ * repeated notes) through the real processor without a host or GUI and
+ * prints block timing, tail latency and the per-stage breakdown collected
+ * by PerformanceMonitor.
+ *
+ * Usage:
+ *   IthacaBenchmark [sampleBankDir] [seconds] [sampleRate] [blockSize]
+ *
+ * Without a sample bank the processor renders its sine-wave fallback, which
+ * still exercises MIDI handling, voice management and the DSP chain.
+ */
+
+#include "ithaca/audio/IthacaPluginProcessor.h"
+
+#include <juce_events/juce_events.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+constexpr double DEFAULT_SECONDS = 30.0;
+constexpr double DEFAULT_SAMPLE_RATE = 48000.0;
+constexpr int DEFAULT_BLOCK_SIZE = 256;
+constexpr int BANK_LOAD_TIMEOUT_MS = 120000;
+
+/**
+ * @brief Deterministic test performance, one beat = 0.5 s (120 BPM)
+ *
+ * - Beat start: four-note chord walking over the keyboard, held 0.4 s
+ * - Off-beats: 16th-note arpeggio above the chord
+ * - Damper down for two bars out of every four (pedalled release tails)
+ * - Bar 4: repeated notes on one key (retrigger / voice stealing path)
+ */
+void fillBlockMidi(juce::MidiBuffer& midi, int64_t blockStart, int numSamples, double sampleRate)
+{
+    const auto beatSamples = static_cast<int64_t>(sampleRate * 0.5);
+    const auto sixteenth = beatSamples / 4;
+    const auto chordHold = static_cast<int64_t>(sampleRate * 0.4);
+    const int64_t blockEnd = blockStart + numSamples;
+
+    for (int64_t tick = (blockStart / sixteenth) * sixteenth; tick < blockEnd + chordHold; tick += sixteenth) {
+        const int64_t beat = tick / beatSamples;
+        const int64_t step = (tick / sixteenth) % 4;
+        const int64_t bar = beat / 4;
+        const int root = 36 + static_cast<int>((beat * 5) % 48);
+        const auto velocity = static_cast<juce::uint8>(30 + (beat * 37) % 97);
+
+        auto addEvent = [&](int64_t time, const juce::MidiMessage& message) {
+            if (time >= blockStart && time < blockEnd) {
+                midi.addEvent(message, static_cast<int>(time - blockStart));
+            }
+        };
+
+        if (step == 0) {
+            for (int interval : { 0, 4, 7, 12 }) {
+                addEvent(tick, juce::MidiMessage::noteOn(1, root + interval, velocity));
+                addEvent(tick + chordHold, juce::MidiMessage::noteOff(1, root + interval));
+            }
+            if (beat % 8 == 0) {
+                addEvent(tick, juce::MidiMessage::controllerEvent(1, 64, 127));
+            } else if (beat % 8 == 7) {
+                addEvent(tick + chordHold, juce::MidiMessage::controllerEvent(1, 64, 0));
+            }
+        } else {
+            const int note = (bar % 4 == 3) ? root + 24 : root + 12 + static_cast<int>(step) * 3;
+            addEvent(tick, juce::MidiMessage::noteOn(1, note, static_cast<juce::uint8>(velocity / 2 + 20)));
+            addEvent(tick + sixteenth - 1, juce::MidiMessage::noteOff(1, note));
+        }
+    }
+}
+
+bool waitForBank(IthacaPluginProcessor& processor, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(BANK_LOAD_TIMEOUT_MS);
+
+    while (processor.isLoadingInProgress()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    // The finished VoiceManager is picked up at the start of the next block
+    buffer.clear();
+    midi.clear();
+    processor.processBlock(buffer, midi);
+    return !processor.hasLoadingError();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const juce::String bankDir = argc > 1 ? juce::String(argv[1]) : juce::String();
+    const double seconds = argc > 2 ? std::atof(argv[2]) : DEFAULT_SECONDS;
+    const double sampleRate = argc > 3 ? std::atof(argv[3]) : DEFAULT_SAMPLE_RATE;
+    const int blockSize = argc > 4 ? std::atoi(argv[4]) : DEFAULT_BLOCK_SIZE;
+
+    if (seconds <= 0.0 || sampleRate <= 0.0 || blockSize <= 0) {
+        std::fprintf(stderr, "Usage: IthacaBenchmark [sampleBankDir] [seconds] [sampleRate] [blockSize]\n");
+        return 2;
+    }
+
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    IthacaPluginProcessor processor;
+    processor.setNonRealtime(true);
+    processor.setPlayConfigDetails(0, 2, sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+
+    if (bankDir.isNotEmpty()) {
+        processor.loadSampleBankFromDirectory(bankDir);
+        if (!waitForBank(processor, buffer, midi)) {
+            std::fprintf(stderr, "Sample bank failed to load: %s\n", processor.getLoadingErrorMessage().c_str());
+            return 1;
+        }
+    }
+
+    std::printf("IthacaBenchmark: %s, %.1f s at %.0f Hz, block %d\n",
+                bankDir.isEmpty() ? "sine-wave fallback" : bankDir.toRawUTF8(), seconds, sampleRate, blockSize);
+
+    const auto totalSamples = static_cast<int64_t>(seconds * sampleRate);
+    int64_t rendered = 0;
+    int64_t blocks = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    while (rendered < totalSamples) {
+        buffer.clear();
+        midi.clear();
+        fillBlockMidi(midi, rendered, blockSize, sampleRate);
+        processor.processBlock(buffer, midi);
+        rendered += blockSize;
+        ++blocks;
+    }
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const auto stats = processor.getSamplerStats();
+    const auto& stages = stats.stageBreakdown;
+
+    std::printf("Rendered %lld blocks in %.3f s wall (%.1fx realtime)\n",
+                static_cast<long long>(blocks), wallSeconds,
+                wallSeconds > 0.0 ? (rendered / sampleRate) / wallSeconds : 0.0);
+    std::printf("Block time: avg %.4f ms, max %.4f ms, p50 %.4f, p95 %.4f, p99 %.4f, p99.9 %.4f ms\n",
+                stats.avgProcessingTimeMs, stats.maxProcessingTimeMs,
+                stats.p50ProcessingTimeMs, stats.p95ProcessingTimeMs,
+                stats.p99ProcessingTimeMs, stats.p999ProcessingTimeMs);
+    std::printf("%-10s %12s %12s %8s\n", "Stage", "avg us/blk", "max us/blk", "share");
+    for (int i = 0; i < PerformanceMonitor::NUM_STAGES; ++i) {
+        const auto index = static_cast<size_t>(i);
+        std::printf("%-10s %12.2f %12.2f %7.1f%%\n",
+                    PerformanceMonitor::getStageName(static_cast<PerformanceMonitor::Stage>(i)),
+                    stages.avgUsPerBlock[index], stages.maxUsPerBlock[index], stages.sharePercent[index]);
+    }
+
+    processor.releaseResources();
+    return 0;
+}
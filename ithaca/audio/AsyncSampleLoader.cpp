@@ -5,10 +5,23 @@
 
 #include "ithaca/audio/AsyncSampleLoader.h"
 #include "ithaca/audio/InstrumentMetadata.h"
+#include "ithaca/audio/ReleaseTriggerPool.h"
+#include "ithaca/audio/SampleBankScanner.h"
+#include "ithaca/audio/SharedEnvelopeData.h"
+#include "ithaca/audio/TraceRecorder.h"
+#include "ithaca/config/AppConstants.h"
 #include "ithaca-core/sampler/voice_manager.h"
-#include "ithaca-core/sampler/envelopes/envelope_static_data.h"
 #include "ithaca-core/sampler/core_logger.h"
 #include <juce_core/juce_core.h>
+#include <chrono>
+
+namespace {
+    int64_t steadyNowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
 
 //==============================================================================
 // Constructor / Destructor
@@ -17,6 +30,8 @@ AsyncSampleLoader::AsyncSampleLoader()
     : shouldStop_(false),
       state_(LoadingState::Idle),
       targetSampleRate_(0),
+      targetBlockSize_(0),
+      preparedBlockSize_(0),
       velocityLayerCount_(0)
 {
 }
@@ -34,17 +49,34 @@ void AsyncSampleLoader::startLoading(const std::string& sampleDirectory,
                                      int blockSize,
                                      Logger& logger)
 {
+    // Same bank at the same rate already loading - nothing to do
+    // (the resident check needs the fingerprint and runs in the worker)
+    if (isRedundantLoad(sampleDirectory, targetSampleRate, logger)) {
+        return;
+    }
+
     // Stop any previous loading operation
+    const bool cancellingPrevious = isInProgress();
     stopLoading();
+    if (cancellingPrevious) {
+        logger.log("AsyncSampleLoader/startLoading", LogSeverity::Info,
+                  "Previous load cancelled in " + std::to_string(lastCancelLatencyMs_.load()) + " ms");
+    }
     
     // Reset state for new loading operation
     {
         std::lock_guard<std::mutex> lock(stateMutex_);
         state_.store(LoadingState::InProgress);
         targetSampleRate_ = targetSampleRate;
+        targetBlockSize_.store(blockSize);
+        requestedBank_ = BankKey { sampleDirectory, targetSampleRate };
         errorMessage_.clear();
         shouldStop_.store(false);
+        if (voiceManager_) {
+            residentBank_ = BankKey();  // Completed bank dropped before transfer
+        }
         voiceManager_.reset();
+        releasePool_.reset();
     }
     
     // Start worker thread
@@ -53,7 +85,6 @@ void AsyncSampleLoader::startLoading(const std::string& sampleDirectory,
         this,
         sampleDirectory,
         targetSampleRate,
-        blockSize,
         &logger
     );
 }
@@ -74,12 +105,8 @@ void AsyncSampleLoader::initializeWithSineWaves(int targetSampleRate,
     stopLoading();
 
     try {
-        // Initialize EnvelopeStaticData if not already done
-        if (!EnvelopeStaticData::isInitialized()) {
-            logger.log("AsyncSampleLoader/initializeWithSineWaves", LogSeverity::Info,
-                      "Initializing envelope static data...");
-            EnvelopeStaticData::initialize(logger);
-        }
+        // Envelope tables are shared by all instances - serialized init if not already done
+        SharedEnvelopeData::ensureInitialized(logger);
 
         // Create VoiceManager with sine waves (synchronous, fast)
         logger.log("AsyncSampleLoader/initializeWithSineWaves", LogSeverity::Info,
@@ -93,6 +120,11 @@ void AsyncSampleLoader::initializeWithSineWaves(int targetSampleRate,
         {
             std::lock_guard<std::mutex> lock(stateMutex_);
             voiceManager_ = std::move(vm);
+            targetBlockSize_.store(blockSize);
+            preparedBlockSize_ = blockSize;
+            releasePool_.reset();  // Sine waves have no release triggers
+            residentBank_ = BankKey();
+            clearProgress();
             targetSampleRate_ = targetSampleRate;
             velocityLayerCount_ = velocityLayerCount;
             instrumentName_ = "Sine Wave Test Tone";
@@ -125,8 +157,19 @@ void AsyncSampleLoader::loadSampleBankAsync(const std::string& sampleDirectory,
         return;
     }
 
+    // Same bank at the same rate already loading - nothing to do
+    // (the resident check needs the fingerprint and runs in the worker)
+    if (isRedundantLoad(sampleDirectory, targetSampleRate_, logger)) {
+        return;
+    }
+
     // Stop any previous loading operation
+    const bool cancellingPrevious = isInProgress();
     stopLoading();
+    if (cancellingPrevious) {
+        logger.log("AsyncSampleLoader/loadSampleBankAsync", LogSeverity::Info,
+                  "Previous load cancelled in " + std::to_string(lastCancelLatencyMs_.load()) + " ms");
+    }
 
     // Use stored sample rate (set during sine wave initialization)
     int currentSampleRate = targetSampleRate_;
@@ -138,6 +181,7 @@ void AsyncSampleLoader::loadSampleBankAsync(const std::string& sampleDirectory,
     {
         std::lock_guard<std::mutex> lock(stateMutex_);
         state_.store(LoadingState::InProgress);
+        requestedBank_ = BankKey { sampleDirectory, currentSampleRate };
         errorMessage_.clear();
         shouldStop_.store(false);
     }
@@ -159,6 +203,8 @@ void AsyncSampleLoader::stopLoading()
     }
     
     // Signal thread to stop
+    const bool wasRunning = state_.load() == LoadingState::InProgress;
+    const int64_t stopRequestedNs = steadyNowNs();
     shouldStop_.store(true);
     
     // Wait for thread to finish
@@ -167,6 +213,11 @@ void AsyncSampleLoader::stopLoading()
     }
     
     loadingThread_.reset();
+    phase_.store(LoadPhase::Idle);
+
+    if (wasRunning) {
+        lastCancelLatencyMs_.store(static_cast<double>(steadyNowNs() - stopRequestedNs) / 1.0e6);
+    }
 }
 
 //==============================================================================
@@ -221,6 +272,12 @@ std::unique_ptr<VoiceManager> AsyncSampleLoader::takeVoiceManager()
     return result;
 }
 
+std::unique_ptr<ReleaseTriggerPool> AsyncSampleLoader::takeReleaseTriggerPool()
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    return std::move(releasePool_);
+}
+
 std::string AsyncSampleLoader::getInstrumentName() const
 {
     std::lock_guard<std::mutex> lock(stateMutex_);
@@ -238,9 +295,11 @@ int AsyncSampleLoader::getVelocityLayerCount() const
 
 void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
                                        int targetSampleRate,
-                                       int blockSize,
                                        Logger* logger)
 {
+    ITHACA_TRACE_THREAD("Loader");
+    ITHACA_TRACE_SCOPE("workerFunction");
+
     try {
         // Step 1: Check for interruption
         if (shouldStop_.load()) {
@@ -248,6 +307,18 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
             return;
         }
 
+        // Step 1a: One listing of the bank directory - fingerprint, totals, size estimate
+        const auto footprint = scanBank(sampleDirectory, targetSampleRate);
+        if (shouldStop_.load()) {
+            state_.store(LoadingState::Idle);
+            return;
+        }
+
+        // Step 1b: Same bank content already resident - nothing to load
+        if (skipIfResident(sampleDirectory, footprint.fingerprint, *logger)) {
+            return;
+        }
+
         logger->log("AsyncSampleLoader", LogSeverity::Info,
                    "=== ASYNC LOADING STARTED ===");
         logger->log("AsyncSampleLoader", LogSeverity::Info,
@@ -255,7 +326,7 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         logger->log("AsyncSampleLoader", LogSeverity::Info,
                    "Sample directory: " + sampleDirectory);
 
-        // Step 1a: Load instrument metadata from JSON
+        // Step 1c: Load instrument metadata from JSON
         logger->log("AsyncSampleLoader", LogSeverity::Info,
                    "Loading instrument metadata...");
 
@@ -303,17 +374,9 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         logger->log("AsyncSampleLoader/Metadata", LogSeverity::Info,
                    "===========================");
         
-        // Step 2: Initialize EnvelopeStaticData if needed
-        if (!EnvelopeStaticData::isInitialized()) {
-            logger->log("AsyncSampleLoader", LogSeverity::Info, 
-                       "Initializing envelope static data...");
-            
-            if (!EnvelopeStaticData::initialize(*logger)) {
-                throw std::runtime_error("Envelope static data initialization failed");
-            }
-            
-            logger->log("AsyncSampleLoader", LogSeverity::Info, 
-                       "Envelope static data initialized successfully");
+        // Step 2: Initialize EnvelopeStaticData if needed (shared, serialized with other instances)
+        if (!SharedEnvelopeData::ensureInitialized(*logger)) {
+            throw std::runtime_error("Envelope static data initialization failed");
         }
         
         // Step 3: Check for interruption
@@ -324,7 +387,11 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
             return;
         }
         
-        // Step 4: Create VoiceManager with velocity layer count
+        // Step 4: Publish bank totals from the scan
+        beginProgress(footprint, *logger);
+
+        // Step 4a: Create VoiceManager with velocity layer count
+
         int velocityLayers = metadata.velocityMaps;
         logger->log("AsyncSampleLoader", LogSeverity::Info,
                    "Creating VoiceManager with " + std::to_string(velocityLayers) + " velocity layers...");
@@ -346,7 +413,10 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
                    "Initializing sampler system (scanning directory)...");
         
-        vm->initializeSystem(*logger);
+        {
+            ITHACA_TRACE_SCOPE("initializeSystem");
+            vm->initializeSystem(*logger);
+        }
         
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
                    "System initialization completed");
@@ -365,10 +435,17 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
                    "This may take a few seconds...");
         
-        vm->loadForSampleRate(targetSampleRate, *logger);
+        {
+            ITHACA_TRACE_SCOPE("loadForSampleRate");
+            vm->loadForSampleRate(targetSampleRate, *logger);
+        }
+        completeBankProgress();
         
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
                    "Samples loaded successfully");
+
+        // Step 8a: Release-trigger samples (same pass, optional)
+        auto releasePool = loadReleaseTriggers(sampleDirectory, metadata, targetSampleRate, *logger);
         
         // Step 9: Check for interruption
         if (shouldStop_.load()) {
@@ -382,7 +459,7 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
                    "Preparing VoiceManager for audio processing...");
         
-        vm->prepareToPlay(blockSize);
+        int preparedBlockSize = prepareVoiceManager(*vm, *logger);
         vm->setRealTimeMode(true);
         
         logger->log("AsyncSampleLoader", LogSeverity::Info, 
@@ -390,8 +467,11 @@ void AsyncSampleLoader::workerFunction(const std::string& sampleDirectory,
         
         // Step 11: Store result and mark as completed
         {
-            std::lock_guard<std::mutex> lock(stateMutex_);
+            auto lock = lockPrepared(*vm, preparedBlockSize, *logger);
+            preparedBlockSize_ = preparedBlockSize;
             voiceManager_ = std::move(vm);
+            releasePool_ = std::move(releasePool);
+            residentBank_ = requestedBank_;
             state_.store(LoadingState::Completed);
         }
         
@@ -432,6 +512,9 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
                                                   int targetSampleRate,
                                                   Logger* logger)
 {
+    ITHACA_TRACE_THREAD("Loader");
+    ITHACA_TRACE_SCOPE("sampleBankWorkerFunction");
+
     try {
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
@@ -449,6 +532,23 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
             return;
         }
 
+        // One listing of the bank directory - fingerprint, totals, size estimate
+        const auto footprint = scanBank(sampleDirectory, targetSampleRate);
+        if (shouldStop_.load()) {
+            if (logger) {
+                logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Warning,
+                           "Loading interrupted during bank scan");
+            }
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            state_.store(LoadingState::Idle);
+            return;
+        }
+
+        // Same bank content already resident - nothing to load
+        if (skipIfResident(sampleDirectory, footprint.fingerprint, *logger)) {
+            return;
+        }
+
         // Load instrument metadata
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
@@ -469,6 +569,9 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
             return;
         }
 
+        // Publish bank totals from the scan
+        beginProgress(footprint, *logger);
+
         // Create new VoiceManager with sample bank (old one was moved to processor)
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
@@ -499,7 +602,10 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
                        "Initializing sampler system (scanning directory)...");
         }
 
-        newVoiceManager->initializeSystem(*logger);
+        {
+            ITHACA_TRACE_SCOPE("initializeSystem");
+            newVoiceManager->initializeSystem(*logger);
+        }
 
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
@@ -523,13 +629,20 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
                        "Loading sample bank with target sample rate: " + std::to_string(targetSampleRate) + " Hz...");
         }
 
-        newVoiceManager->loadSampleBank(sampleDirectory, targetSampleRate, *logger);
+        {
+            ITHACA_TRACE_SCOPE("loadSampleBank");
+            newVoiceManager->loadSampleBank(sampleDirectory, targetSampleRate, *logger);
+        }
+        completeBankProgress();
 
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
                        "Sample bank loaded successfully");
         }
 
+        // Release-trigger samples (same pass, optional)
+        auto releasePool = loadReleaseTriggers(sampleDirectory, metadata, targetSampleRate, *logger);
+
         // Check for stop signal
         if (shouldStop_.load()) {
             if (logger) {
@@ -541,28 +654,29 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
             return;
         }
 
-        // Prepare to play
-        int blockSize = 256;  // Default block size
-        if (logger) {
-            logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
-                       "Preparing to play (block size: " + std::to_string(blockSize) + ")...");
-        }
-
-        newVoiceManager->prepareToPlay(blockSize);
+        // Prepare to play (live host block size)
+        int preparedBlockSize = prepareVoiceManager(*newVoiceManager, *logger);
 
         if (logger) {
             logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Info,
                        "Prepared to play successfully");
         }
 
-        // Store new VoiceManager (thread-safe)
+        // Store new VoiceManager (thread-safe) - a cancelled load publishes nothing,
+        // otherwise a later request could complete with this bank
+        bool published = false;
         {
-            std::lock_guard<std::mutex> lock(stateMutex_);
-            voiceManager_ = std::move(newVoiceManager);
+            auto lock = lockPrepared(*newVoiceManager, preparedBlockSize, *logger);
+            if (!shouldStop_.load()) {
+                preparedBlockSize_ = preparedBlockSize;
+                voiceManager_ = std::move(newVoiceManager);
+                releasePool_ = std::move(releasePool);
+                published = true;
+            }
         }
 
         // Check for stop signal
-        if (shouldStop_.load()) {
+        if (!published) {
             if (logger) {
                 logger->log("AsyncSampleLoader/sampleBankWorker", LogSeverity::Warning,
                            "Loading interrupted after sample loading");
@@ -577,6 +691,7 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
             std::lock_guard<std::mutex> lock(stateMutex_);
             instrumentName_ = metadata.instrumentName.toStdString();
             velocityLayerCount_ = metadata.velocityMaps;
+            residentBank_ = requestedBank_;
             state_.store(LoadingState::Completed);
         }
 
@@ -613,4 +728,199 @@ void AsyncSampleLoader::sampleBankWorkerFunction(const std::string& sampleDirect
                        "Unknown exception caught");
         }
     }
-}
\ No newline at end of file
+}
+
+//==============================================================================
+// Release Triggers
+
+std::unique_ptr<ReleaseTriggerPool> AsyncSampleLoader::loadReleaseTriggers(const std::string& sampleDirectory,
+                                                                           const InstrumentMetadata& metadata,
+                                                                           int targetSampleRate,
+                                                                           Logger& logger)
+{
+    if (!metadata.hasReleaseTriggers || shouldStop_.load()) {
+        return nullptr;
+    }
+
+    auto releaseDir = juce::File(sampleDirectory).getChildFile(metadata.releaseTriggerDirectory);
+    logger.log("AsyncSampleLoader/loadReleaseTriggers", LogSeverity::Info,
+              "Loading release triggers from " + releaseDir.getFullPathName().toStdString() + "...");
+
+    ITHACA_TRACE_SCOPE("loadReleaseTriggers");
+    phase_.store(LoadPhase::ReleaseTriggers);
+    auto pool = std::make_unique<ReleaseTriggerPool>();
+    if (pool->loadFromDirectory(releaseDir, targetSampleRate, metadata.releaseTriggerVoices,
+                                shouldStop_, logger) == 0) {
+        return nullptr;
+    }
+
+    residentBytes_.store(residentBytes_.load() + pool->getMemoryBytes());
+    return pool;
+}
+
+//==============================================================================
+// Progress
+
+AsyncSampleLoader::LoadProgress AsyncSampleLoader::getLoadProgress() const
+{
+    LoadProgress progress;
+    progress.phase = state_.load() == LoadingState::InProgress ? phase_.load() : LoadPhase::Idle;
+    progress.lastCancelLatencyMs = lastCancelLatencyMs_.load();
+    progress.filesTotal = progressFilesTotal_.load();
+    progress.filesLoaded = progressFilesLoaded_.load();
+    progress.bytesTotal = progressBytesTotal_.load();
+    progress.bytesLoaded = progressBytesLoaded_.load();
+    progress.residentBytes = residentBytes_.load();
+
+    const int64_t startNs = loadStartNs_.load();
+    if (startNs > 0) {
+        const int64_t endNs = loadEndNs_.load();
+        const double seconds = static_cast<double>((endNs > 0 ? endNs : steadyNowNs()) - startNs) / 1.0e9;
+        progress.bytesPerSecond = seconds > 0.0 ? progress.bytesLoaded / seconds : 0.0;
+    }
+
+    return progress;
+}
+
+void AsyncSampleLoader::setBlockSize(int blockSize)
+{
+    if (blockSize <= 0) {
+        return;
+    }
+
+    // Loaded but not yet taken by the processor - re-prepare here, not on the audio
+    // thread, and with the VoiceManager checked out of stateMutex_ (the audio thread
+    // polls hasVoiceManager() under it; while checked out it sees no VoiceManager)
+    std::unique_ptr<VoiceManager> pending;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        targetBlockSize_.store(blockSize);
+        if (voiceManager_ && preparedBlockSize_ != blockSize) {
+            pending = std::move(voiceManager_);
+        }
+    }
+
+    if (!pending) {
+        return;
+    }
+
+    {
+        ITHACA_TRACE_SCOPE("prepareToPlay");
+        pending->prepareToPlay(blockSize);
+    }
+
+    // A newer bank published meanwhile wins; the stale one is freed after unlock
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    if (!voiceManager_) {
+        voiceManager_ = std::move(pending);
+        preparedBlockSize_ = blockSize;
+    }
+}
+
+int AsyncSampleLoader::prepareVoiceManager(VoiceManager& vm, Logger& logger)
+{
+    ITHACA_TRACE_SCOPE("prepareToPlay");
+
+    int blockSize = targetBlockSize_.load();
+    if (blockSize <= 0) {
+        blockSize = Constants::Audio::BufferSizes::DEFAULT_BUFFER;
+    }
+
+    logger.log("AsyncSampleLoader/prepareVoiceManager", LogSeverity::Info,
+              "Preparing to play (block size: " + std::to_string(blockSize) + ")...");
+    vm.prepareToPlay(blockSize);
+    return blockSize;
+}
+
+std::unique_lock<std::mutex> AsyncSampleLoader::lockPrepared(VoiceManager& vm, int& preparedBlockSize, Logger& logger)
+{
+    std::unique_lock<std::mutex> lock(stateMutex_);
+
+    // Host changed the block size while we were preparing - re-prepare unlocked
+    // (prepareToPlay allocates) and check again
+    for (;;) {
+        const int blockSize = targetBlockSize_.load();
+        if (blockSize <= 0 || blockSize == preparedBlockSize) {
+            return lock;
+        }
+        lock.unlock();
+        preparedBlockSize = prepareVoiceManager(vm, logger);
+        lock.lock();
+    }
+}
+
+bool AsyncSampleLoader::isRedundantLoad(const std::string& sampleDirectory, int targetSampleRate, Logger& logger) const
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+
+    if (state_.load() != LoadingState::InProgress ||
+        requestedBank_.directory != sampleDirectory || requestedBank_.sampleRate != targetSampleRate) {
+        return false;
+    }
+
+    logger.log("AsyncSampleLoader/isRedundantLoad", LogSeverity::Info,
+              "Skipping reload of " + sampleDirectory + " @ " + std::to_string(targetSampleRate) +
+              " Hz (already loading)");
+    return true;
+}
+
+SampleBankFootprint AsyncSampleLoader::scanBank(const std::string& sampleDirectory, int targetSampleRate)
+{
+    ITHACA_TRACE_SCOPE("scanBank");
+    phase_.store(LoadPhase::Scanning);
+    return SampleBankScanner::scan(juce::File(sampleDirectory), targetSampleRate, shouldStop_);
+}
+
+bool AsyncSampleLoader::skipIfResident(const std::string& sampleDirectory, uint64_t fingerprint, Logger& logger)
+{
+    std::lock_guard<std::mutex> lock(stateMutex_);
+    requestedBank_.fingerprint = fingerprint;
+
+    if (residentBank_.directory.empty() || !(residentBank_ == requestedBank_)) {
+        return false;
+    }
+
+    // A finished bank not yet transferred is still waiting in voiceManager_
+    state_.store(voiceManager_ ? LoadingState::Completed : LoadingState::Idle);
+    logger.log("AsyncSampleLoader/skipIfResident", LogSeverity::Info,
+              "Skipping reload of " + sampleDirectory + " @ " + std::to_string(requestedBank_.sampleRate) +
+              " Hz (already resident)");
+    return true;
+}
+
+void AsyncSampleLoader::beginProgress(const SampleBankFootprint& footprint, Logger& logger)
+{
+    progressFilesTotal_.store(static_cast<int>(footprint.files.size()));
+    progressFilesLoaded_.store(0);
+    progressBytesTotal_.store(footprint.totalFileBytes);
+    progressBytesLoaded_.store(0);
+    residentBytes_.store(footprint.totalResidentBytes);
+    loadEndNs_.store(0);
+    loadStartNs_.store(steadyNowNs());
+
+    logger.log("AsyncSampleLoader/beginProgress", LogSeverity::Info,
+              "Bank footprint: " + std::to_string(footprint.files.size()) + " files, " +
+              std::to_string(footprint.totalFileBytes / (1024 * 1024)) + " MB on disk, ~" +
+              std::to_string(footprint.totalResidentBytes / (1024 * 1024)) + " MB resident");
+
+    phase_.store(LoadPhase::Decoding);
+}
+
+void AsyncSampleLoader::completeBankProgress()
+{
+    progressFilesLoaded_.store(progressFilesTotal_.load());
+    progressBytesLoaded_.store(progressBytesTotal_.load());
+    loadEndNs_.store(steadyNowNs());
+}
+
+void AsyncSampleLoader::clearProgress()
+{
+    progressFilesTotal_.store(0);
+    progressFilesLoaded_.store(0);
+    progressBytesTotal_.store(0);
+    progressBytesLoaded_.store(0);
+    residentBytes_.store(0);
+    loadStartNs_.store(0);
+    loadEndNs_.store(0);
+    phase_.store(LoadPhase::Idle);
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <thread>
 #include <memory>
 #include <string>
@@ -17,6 +18,9 @@
 // Forward declarations - avoid including heavy headers
 class VoiceManager;
 class Logger;
+class ReleaseTriggerPool;
+struct InstrumentMetadata;
+struct SampleBankFootprint;
 
 /**
  * @class AsyncSampleLoader
@@ -42,6 +46,52 @@ public:
         Error          ///< Loading failed with error
     };
 
+    /**
+     * @struct BankKey
+     * @brief Identity of a bank load: directory, engine sample rate, content fingerprint
+     */
+    struct BankKey {
+        std::string directory;
+        int sampleRate = 0;
+        uint64_t fingerprint = 0;
+
+        bool operator==(const BankKey& other) const {
+            return directory == other.directory && sampleRate == other.sampleRate &&
+                   fingerprint == other.fingerprint;
+        }
+    };
+
+    /**
+     * @enum LoadPhase
+     * @brief Step of the running load (Idle when no load is in progress)
+     */
+    enum class LoadPhase {
+        Idle,
+        Scanning,           ///< Directory listing (fingerprint, totals)
+        Decoding,           ///< IthacaCore decode (not interruptible, no per-file progress)
+        ReleaseTriggers     ///< Release-trigger samples
+    };
+
+    /**
+     * @struct LoadProgress
+     * @brief Loading progress and footprint of the current/last bank
+     *
+     * Totals come from one directory listing (SampleBankScanner) before decoding;
+     * the decode itself runs inside IthacaCore, so the main bank advances in
+     * one step when loadSampleBank() returns. Progress is therefore reported
+     * per phase, not per file.
+     */
+    struct LoadProgress {
+        LoadPhase phase = LoadPhase::Idle;
+        double lastCancelLatencyMs = 0.0; ///< Time the last stopLoading() waited for the worker
+        int filesTotal = 0;
+        int filesLoaded = 0;
+        int64_t bytesTotal = 0;         ///< Bank size on disk
+        int64_t bytesLoaded = 0;
+        int64_t residentBytes = 0;      ///< Decoded size estimate (bank + release triggers)
+        double bytesPerSecond = 0.0;    ///< Disk throughput of the current/last load
+    };
+
     /**
      * @brief Constructor - initializes loader in Idle state
      */
@@ -104,6 +154,15 @@ public:
      */
     void loadSampleBankAsync(const std::string& sampleDirectory, Logger& logger);
 
+    /**
+     * @brief Update host block size (call from prepareToPlay)
+     * @param blockSize Maximum samples per block announced by the host
+     *
+     * A load in progress prepares its VoiceManager for this size; a loaded
+     * VoiceManager not yet taken is re-prepared here, off the audio thread.
+     */
+    void setBlockSize(int blockSize);
+
     /**
      * @brief Stop loading gracefully
      *
@@ -144,6 +203,11 @@ public:
      * @return Sample rate in Hz (0 if never started)
      */
     int getTargetSampleRate() const;
+
+    /**
+     * @brief Get loading progress and bank footprint (lock-free)
+     */
+    LoadProgress getLoadProgress() const;
     
     //==========================================================================
     // Result Transfer
@@ -158,6 +222,14 @@ public:
      */
     std::unique_ptr<VoiceManager> takeVoiceManager();
 
+    /**
+     * @brief Transfer ownership of release-trigger pool loaded with the bank
+     * @return Unique pointer to ReleaseTriggerPool (nullptr if bank has none)
+     *
+     * Call right after takeVoiceManager() - the pool belongs to the same bank.
+     */
+    std::unique_ptr<ReleaseTriggerPool> takeReleaseTriggerPool();
+
     /**
      * @brief Check if VoiceManager is available
      * @return true if VoiceManager exists and can be transferred
@@ -188,13 +260,35 @@ private:
     
     std::atomic<LoadingState> state_;             ///< Current loading state
     int targetSampleRate_;                        ///< Target sample rate
+    std::atomic<int> targetBlockSize_;            ///< Host block size (latest prepareToPlay)
+    int preparedBlockSize_;                       ///< Block size voiceManager_ was prepared for
     std::string errorMessage_;                    ///< Error details
     mutable std::mutex stateMutex_;               ///< Protects errorMessage_
+
+    //==========================================================================
+    // Progress (written by worker, read lock-free)
+
+    std::atomic<int> progressFilesTotal_ { 0 };
+    std::atomic<int> progressFilesLoaded_ { 0 };
+    std::atomic<int64_t> progressBytesTotal_ { 0 };
+    std::atomic<int64_t> progressBytesLoaded_ { 0 };
+    std::atomic<int64_t> residentBytes_ { 0 };
+    std::atomic<int64_t> loadStartNs_ { 0 };      ///< steady_clock, 0 = no load yet
+    std::atomic<int64_t> loadEndNs_ { 0 };        ///< 0 while decoding
+    std::atomic<LoadPhase> phase_ { LoadPhase::Idle };
+    std::atomic<double> lastCancelLatencyMs_ { 0.0 };
+
+    //==========================================================================
+    // Load Deduplication (protected by stateMutex_)
+
+    BankKey requestedBank_;                       ///< Bank of the current/last started load (fingerprint set by worker)
+    BankKey residentBank_;                        ///< Last bank loaded successfully (empty = sine waves)
     
     //==========================================================================
     // Result Storage
 
     std::unique_ptr<VoiceManager> voiceManager_;  ///< Loaded VoiceManager
+    std::unique_ptr<ReleaseTriggerPool> releasePool_; ///< Loaded release triggers (optional)
     std::string instrumentName_;                   ///< Loaded instrument name from JSON
     int velocityLayerCount_;                       ///< Loaded velocity layer count from JSON (1-8)
     
@@ -205,7 +299,6 @@ private:
      * @brief Worker function running in background thread
      * @param sampleDirectory Sample directory path
      * @param targetSampleRate Target sample rate
-     * @param blockSize Block size for audio processing
      * @param logger Logger pointer (guaranteed valid during execution)
      * 
      * This function:
@@ -219,7 +312,6 @@ private:
      */
     void workerFunction(const std::string& sampleDirectory,
                        int targetSampleRate,
-                       int blockSize,
                        Logger* logger);
 
     /**
@@ -238,4 +330,78 @@ private:
     void sampleBankWorkerFunction(const std::string& sampleDirectory,
                                    int targetSampleRate,
                                    Logger* logger);
+
+    /**
+     * @brief Load release-trigger samples declared in metadata (worker thread)
+     * @param sampleDirectory Sample directory path
+     * @param metadata Instrument metadata with releaseTriggers declaration
+     * @param targetSampleRate Target sample rate
+     * @param logger Logger reference
+     * @return Loaded pool, or nullptr if the bank declares none / none found
+     */
+    std::unique_ptr<ReleaseTriggerPool> loadReleaseTriggers(const std::string& sampleDirectory,
+                                                            const InstrumentMetadata& metadata,
+                                                            int targetSampleRate,
+                                                            Logger& logger);
+
+    /**
+     * @brief Prepare a finished VoiceManager for the current host block size
+     * @param vm VoiceManager built by a worker
+     * @param logger Logger reference
+     * @return Block size vm is prepared for
+     */
+    int prepareVoiceManager(VoiceManager& vm, Logger& logger);
+
+    /**
+     * @brief Lock stateMutex_ with vm prepared for the current host block size
+     * @param vm VoiceManager about to be published
+     * @param preparedBlockSize Block size vm is prepared for (updated on re-prepare)
+     * @param logger Logger reference
+     * @return Held lock - publish vm under it
+     *
+     * prepareToPlay() allocates, so it never runs under stateMutex_, which the
+     * audio thread takes in hasVoiceManager()/takeVoiceManager().
+     */
+    std::unique_lock<std::mutex> lockPrepared(VoiceManager& vm, int& preparedBlockSize, Logger& logger);
+
+    /**
+     * @brief Check whether the same bank at the same rate is already loading (caller thread)
+     * @return true (and logs) if the request can be skipped
+     *
+     * Hosts call prepareToPlay() repeatedly (transport start, offline bounce);
+     * without this every call would restart the running load. Cheap - no
+     * directory listing on the message thread.
+     */
+    bool isRedundantLoad(const std::string& sampleDirectory, int targetSampleRate, Logger& logger) const;
+
+    /**
+     * @brief List the bank directory once: fingerprint, file totals, size estimate (worker thread)
+     */
+    SampleBankFootprint scanBank(const std::string& sampleDirectory, int targetSampleRate);
+
+    /**
+     * @brief Record the requested bank's fingerprint and skip the load if it is resident (worker thread)
+     * @param fingerprint Content fingerprint from scanBank()
+     * @return true (and logs) if the load was skipped; state is restored, nothing is published
+     *
+     * Compared against the last completed bank only, so a request for the
+     * resident bank made while another bank was loading (cancelled by this
+     * request) does not reload it.
+     */
+    bool skipIfResident(const std::string& sampleDirectory, uint64_t fingerprint, Logger& logger);
+
+    /**
+     * @brief Publish bank totals from the scan and reset progress counters (worker thread)
+     */
+    void beginProgress(const SampleBankFootprint& footprint, Logger& logger);
+
+    /**
+     * @brief Mark main bank decoded (worker thread)
+     */
+    void completeBankProgress();
+
+    /**
+     * @brief Clear progress counters (sine wave mode)
+     */
+    void clearProgress();
 };
\ No newline at end of file
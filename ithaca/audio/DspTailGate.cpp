@@ -0,0 +1,74 @@
+/**
+ * @file DspTailGate.cpp
+ * @brief Implementation of the DSP chain tail gate
+ */
+
+#include "ithaca/audio/DspTailGate.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float SILENCE_THRESHOLD = Constants::Audio::Idle::SILENCE_THRESHOLD;
+    constexpr double TAIL_HOLD_MS = Constants::Audio::Idle::TAIL_HOLD_MS;
+}
+
+//==============================================================================
+// Constructor / Configuration
+
+DspTailGate::DspTailGate()
+    : holdSamples_(static_cast<int64_t>(48000.0 * TAIL_HOLD_MS / 1000.0)),
+      bypassed_(false),
+      bypassedBlocks_(0)
+{
+}
+
+void DspTailGate::setSampleRate(double sampleRate)
+{
+    const double rate = sampleRate > 0.0 ? sampleRate : 48000.0;
+    holdSamples_ = static_cast<int64_t>(rate * TAIL_HOLD_MS / 1000.0);
+    reset();
+}
+
+//==============================================================================
+// Audio Thread
+
+bool DspTailGate::needsProcessing(bool inputActive)
+{
+    if (inputActive) {
+        quietSamples_ = 0;
+        bypassed_.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (bypassed_.load(std::memory_order_relaxed)) {
+        // Single writer - load/store instead of RMW
+        bypassedBlocks_.store(bypassedBlocks_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+void DspTailGate::observeTail(const float* left, const float* right, int numSamples)
+{
+    float peak = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        peak = std::max(peak, std::max(std::abs(left[i]), std::abs(right[i])));
+    }
+
+    if (peak >= SILENCE_THRESHOLD) {
+        quietSamples_ = 0;
+        return;
+    }
+
+    quietSamples_ += numSamples;
+    if (quietSamples_ >= holdSamples_) {
+        bypassed_.store(true, std::memory_order_relaxed);
+    }
+}
+
+void DspTailGate::reset()
+{
+    quietSamples_ = 0;
+    bypassed_.store(false, std::memory_order_relaxed);
+}
@@ -0,0 +1,77 @@
+/**
+ * @file DspTailGate.h
+ * @brief Skips the IthacaCore DSP chain (finalizeBlock) while it has nothing to do
+ *
+ * The chain (LFO pan, BBE, limiter) lives inside VoiceManager::finalizeBlock()
+ * and cannot be bypassed per effect from the plugin. What the plugin can see is
+ * the chain's input (voices rendering) and its output. Once no voice renders
+ * and the output has stayed below the noise floor for TAIL_HOLD_MS, every
+ * effect is at rest: processing silence would only produce silence, so the
+ * call is skipped. The first block with an active voice runs the chain again;
+ * its filters and gain stages resume from rest, so no crossfade is needed.
+ */
+
+#pragma once
+
+#include "ithaca/config/AppConstants.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class DspTailGate
+ * @brief Audio-thread tail tracker for the DSP chain
+ *
+ * Features:
+ * - Tail detection on the chain output only while no voice is active
+ *   (no per-sample cost during playback)
+ * - Bypass state and bypassed-block counter readable from any thread
+ * - reset() re-arms the chain (new VoiceManager, prepareToPlay)
+ */
+class DspTailGate {
+public:
+    DspTailGate();
+
+    /**
+     * @brief Tail hold time follows the sample rate (call from prepareToPlay)
+     */
+    void setSampleRate(double sampleRate);
+
+    /**
+     * @brief Decide whether the chain must run for this block (audio thread)
+     * @param inputActive Any voice or release trigger rendered into the block
+     * @return false if the chain is at rest and the block is silent
+     */
+    bool needsProcessing(bool inputActive);
+
+    /**
+     * @brief Track the decaying tail of a processed block (audio thread)
+     * @param left Chain output, left channel
+     * @param right Chain output, right channel
+     * @param numSamples Block length
+     *
+     * Call only for blocks without active input; a block with voices resets
+     * the tail in needsProcessing().
+     */
+    void observeTail(const float* left, const float* right, int numSamples);
+
+    /**
+     * @brief Force the chain to run until the tail is verified again (audio thread)
+     */
+    void reset();
+
+    /**
+     * @brief true while the chain is skipped (any thread)
+     */
+    bool isBypassed() const { return bypassed_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Blocks skipped since creation (any thread)
+     */
+    uint64_t getBypassedBlocks() const { return bypassedBlocks_.load(std::memory_order_relaxed); }
+
+private:
+    int64_t holdSamples_;                   ///< Quiet output needed before bypass
+    int64_t quietSamples_ = 0;              ///< Consecutive quiet output samples
+    std::atomic<bool> bypassed_;
+    std::atomic<uint64_t> bypassedBlocks_;
+};
@@ -0,0 +1,144 @@
+/**
+ * @file EngineMetrics.cpp
+ * @brief Implementation of engine load metrics
+ */
+
+#include "ithaca/audio/EngineMetrics.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    constexpr double WINDOW_SECONDS = Constants::Performance::Metrics::WINDOW_SECONDS;
+    constexpr double BYTES_PER_FRAME = 2.0 * sizeof(float);     ///< Stereo float32 sample data
+
+    template <typename T>
+    void bump(std::atomic<T>& value, T amount)
+    {
+        // Single writer - load/store instead of RMW
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+}
+
+//==============================================================================
+// Constructor / Configuration
+
+EngineMetrics::EngineMetrics()
+    : sampleRate_(48000.0),
+      activeVoices_(0),
+      sustainingVoices_(0),
+      releasingVoices_(0),
+      releaseTriggerVoices_(0),
+      noteOnsPerSecond_(0.0),
+      midiEventsPerBlock_(0.0),
+      maxMidiEventsPerBlock_(0),
+      touchedBytesPerBlock_(0.0),
+      totalNoteOns_(0),
+      totalMidiEvents_(0)
+{
+}
+
+void EngineMetrics::setSampleRate(double sampleRate)
+{
+    sampleRate_.store(sampleRate > 0.0 ? sampleRate : 48000.0);
+}
+
+//==============================================================================
+// Audio Thread
+
+void EngineMetrics::recordBlock(const BlockStats& block)
+{
+    activeVoices_.store(block.activeVoices, std::memory_order_relaxed);
+    sustainingVoices_.store(block.sustainingVoices, std::memory_order_relaxed);
+    releasingVoices_.store(block.releasingVoices, std::memory_order_relaxed);
+    releaseTriggerVoices_.store(block.releaseTriggerVoices, std::memory_order_relaxed);
+    bump<uint64_t>(totalNoteOns_, static_cast<uint64_t>(block.noteOns));
+    bump<uint64_t>(totalMidiEvents_, static_cast<uint64_t>(block.midiEvents));
+
+    windowSamples_ += block.numSamples;
+    ++windowBlocks_;
+    windowNoteOns_ += block.noteOns;
+    windowMidiEvents_ += block.midiEvents;
+    windowMaxMidiEvents_ = std::max(windowMaxMidiEvents_, block.midiEvents);
+    windowTouchedBytes_ += static_cast<double>(block.activeVoices + block.releaseTriggerVoices) *
+                           block.numSamples * BYTES_PER_FRAME;
+
+    if (windowSamples_ >= static_cast<int64_t>(sampleRate_.load(std::memory_order_relaxed) * WINDOW_SECONDS)) {
+        publishWindow();
+    }
+}
+
+void EngineMetrics::publishWindow()
+{
+    const double seconds = static_cast<double>(windowSamples_) / sampleRate_.load(std::memory_order_relaxed);
+
+    noteOnsPerSecond_.store(seconds > 0.0 ? windowNoteOns_ / seconds : 0.0, std::memory_order_relaxed);
+    midiEventsPerBlock_.store(static_cast<double>(windowMidiEvents_) / windowBlocks_, std::memory_order_relaxed);
+    maxMidiEventsPerBlock_.store(windowMaxMidiEvents_, std::memory_order_relaxed);
+    touchedBytesPerBlock_.store(windowTouchedBytes_ / windowBlocks_, std::memory_order_relaxed);
+
+    windowSamples_ = 0;
+    windowBlocks_ = 0;
+    windowNoteOns_ = 0;
+    windowMidiEvents_ = 0;
+    windowMaxMidiEvents_ = 0;
+    windowTouchedBytes_ = 0.0;
+}
+
+//==============================================================================
+// Query
+
+EngineMetrics::Snapshot EngineMetrics::getSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.activeVoices = activeVoices_.load(std::memory_order_relaxed);
+    snapshot.sustainingVoices = sustainingVoices_.load(std::memory_order_relaxed);
+    snapshot.releasingVoices = releasingVoices_.load(std::memory_order_relaxed);
+    snapshot.releaseTriggerVoices = releaseTriggerVoices_.load(std::memory_order_relaxed);
+    snapshot.noteOnsPerSecond = noteOnsPerSecond_.load(std::memory_order_relaxed);
+    snapshot.midiEventsPerBlock = midiEventsPerBlock_.load(std::memory_order_relaxed);
+    snapshot.maxMidiEventsPerBlock = maxMidiEventsPerBlock_.load(std::memory_order_relaxed);
+    snapshot.touchedBytesPerBlock = touchedBytesPerBlock_.load(std::memory_order_relaxed);
+    snapshot.totalNoteOns = totalNoteOns_.load(std::memory_order_relaxed);
+    snapshot.totalMidiEvents = totalMidiEvents_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::string EngineMetrics::toJsonLine(const Snapshot& snapshot, const std::string& instrumentName)
+{
+    std::string escapedName;
+    for (char c : instrumentName) {
+        if (escapedName.size() >= 120) {
+            break;  // Keeps the line within the format buffer
+        }
+        if (c == '"' || c == '\\') {
+            escapedName += '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            escapedName += c;
+        }
+    }
+
+    const auto timestampMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    char buffer[768];
+    std::snprintf(buffer, sizeof(buffer),
+        "{\"ts\":%lld,\"instrument\":\"%s\","
+        "\"voices\":{\"active\":%d,\"sustaining\":%d,\"releasing\":%d,\"releaseTriggers\":%d},"
+        "\"noteOnsPerSec\":%.2f,\"midiEventsPerBlock\":%.2f,\"maxMidiEventsPerBlock\":%d,"
+        "\"touchedBytesPerBlock\":%.0f,\"residentSampleBytes\":%lld,"
+        "\"loader\":{\"filesLoaded\":%d,\"filesTotal\":%d,\"bytesLoaded\":%lld,\"bytesTotal\":%lld,\"bytesPerSec\":%.0f},"
+        "\"totalNoteOns\":%llu,\"totalMidiEvents\":%llu}",
+        static_cast<long long>(timestampMs), escapedName.c_str(),
+        snapshot.activeVoices, snapshot.sustainingVoices, snapshot.releasingVoices, snapshot.releaseTriggerVoices,
+        snapshot.noteOnsPerSecond, snapshot.midiEventsPerBlock, snapshot.maxMidiEventsPerBlock,
+        snapshot.touchedBytesPerBlock, static_cast<long long>(snapshot.residentSampleBytes),
+        snapshot.filesLoaded, snapshot.filesTotal,
+        static_cast<long long>(snapshot.bytesLoaded), static_cast<long long>(snapshot.bytesTotal),
+        snapshot.diskBytesPerSecond,
+        static_cast<unsigned long long>(snapshot.totalNoteOns),
+        static_cast<unsigned long long>(snapshot.totalMidiEvents));
+
+    return buffer;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file EngineMetrics.h
+ * @brief Engine load metrics - voices, note rate, MIDI traffic, memory footprint
+ *
+ * Complements PerformanceMonitor (time) with load (what the engine is doing).
+ * The audio thread publishes one block at a time; readers (GUI, metrics log)
+ * take lock-free snapshots. Loader-side values (resident memory, disk
+ * throughput, progress) come from AsyncSampleLoader::getLoadProgress().
+ */
+
+#pragma once
+
+#include "ithaca/config/AppConstants.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class EngineMetrics
+ * @brief Single-writer (audio thread), multi-reader engine load counters
+ *
+ * Rates (note-ons per second, MIDI events per block, touched memory) are
+ * averaged over a window of about one second of audio and published when the
+ * window closes, so readers see stable values without any locking.
+ */
+class EngineMetrics {
+public:
+    /**
+     * @struct BlockStats
+     * @brief What happened in one processBlock() call
+     */
+    struct BlockStats {
+        int numSamples = 0;
+        int activeVoices = 0;
+        int sustainingVoices = 0;
+        int releasingVoices = 0;
+        int releaseTriggerVoices = 0;
+        int midiEvents = 0;
+        int noteOns = 0;
+    };
+
+    /**
+     * @struct Snapshot
+     * @brief Published metrics
+     */
+    struct Snapshot {
+        // Voices (last block)
+        int activeVoices = 0;
+        int sustainingVoices = 0;
+        int releasingVoices = 0;
+        int releaseTriggerVoices = 0;
+
+        // Traffic (window averages)
+        double noteOnsPerSecond = 0.0;
+        double midiEventsPerBlock = 0.0;
+        int maxMidiEventsPerBlock = 0;
+        double touchedBytesPerBlock = 0.0;  ///< Sample memory streamed by active voices (estimate)
+
+        // Memory / loading (from AsyncSampleLoader)
+        int64_t residentSampleBytes = 0;    ///< Decoded bank + release triggers (estimate)
+        int filesTotal = 0;
+        int filesLoaded = 0;
+        int64_t bytesTotal = 0;
+        int64_t bytesLoaded = 0;
+        double diskBytesPerSecond = 0.0;
+
+        // Totals since creation
+        uint64_t totalNoteOns = 0;
+        uint64_t totalMidiEvents = 0;
+    };
+
+    EngineMetrics();
+
+    /**
+     * @brief Window length follows the sample rate (call from prepareToPlay)
+     */
+    void setSampleRate(double sampleRate);
+
+    /**
+     * @brief Publish one block (audio thread, RT-safe)
+     */
+    void recordBlock(const BlockStats& block);
+
+    /**
+     * @brief Lock-free snapshot of the audio-side values (loader fields left zero)
+     */
+    Snapshot getSnapshot() const;
+
+    /**
+     * @brief One-line JSON for the metrics log (non-RT)
+     * @param snapshot Metrics to serialize
+     * @param instrumentName Loaded bank name
+     */
+    static std::string toJsonLine(const Snapshot& snapshot, const std::string& instrumentName);
+
+private:
+    // Window accumulation (audio thread only)
+    std::atomic<double> sampleRate_;
+    int64_t windowSamples_ = 0;
+    int windowBlocks_ = 0;
+    int64_t windowNoteOns_ = 0;
+    int64_t windowMidiEvents_ = 0;
+    int windowMaxMidiEvents_ = 0;
+    double windowTouchedBytes_ = 0.0;
+
+    // Published values (single writer)
+    std::atomic<int> activeVoices_;
+    std::atomic<int> sustainingVoices_;
+    std::atomic<int> releasingVoices_;
+    std::atomic<int> releaseTriggerVoices_;
+    std::atomic<double> noteOnsPerSecond_;
+    std::atomic<double> midiEventsPerBlock_;
+    std::atomic<int> maxMidiEventsPerBlock_;
+    std::atomic<double> touchedBytesPerBlock_;
+    std::atomic<uint64_t> totalNoteOns_;
+    std::atomic<uint64_t> totalMidiEvents_;
+
+    void publishWindow();
+};
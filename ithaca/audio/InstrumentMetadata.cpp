@@ -4,6 +4,8 @@
  */
 
 #include "ithaca/audio/InstrumentMetadata.h"
+#include "ithaca/config/IthacaConfig.h"
+#include "ithaca/config/AppConstants.h"
 #include <fstream>
 
 using json = nlohmann::json;
@@ -86,6 +88,33 @@ std::optional<InstrumentMetadata> InstrumentMetadata::loadFromString(const juce:
             metadata.sampleCount = j["sampleCount"].get<int>();
         }
 
+        // Release-trigger samply (volitelné, objekt)
+        if (j.contains("releaseTriggers")) {
+            const auto& release = j["releaseTriggers"];
+            if (!release.is_object()) {
+                return std::nullopt;
+            }
+
+            metadata.hasReleaseTriggers = true;
+            metadata.releaseTriggerDirectory = Constants::Audio::ReleaseTriggers::DEFAULT_DIRECTORY;
+            metadata.releaseTriggerVoices = Constants::Audio::ReleaseTriggers::DEFAULT_VOICES;
+
+            if (release.contains("directory") && release["directory"].is_string()) {
+                metadata.releaseTriggerDirectory = juce::String(release["directory"].get<std::string>());
+            }
+
+            if (release.contains("voices")) {
+                if (!release["voices"].is_number_integer()) {
+                    return std::nullopt;
+                }
+                int voices = release["voices"].get<int>();
+                if (voices < 1 || voices > ITHACA_MAX_RELEASE_VOICES) {
+                    return std::nullopt;
+                }
+                metadata.releaseTriggerVoices = voices;
+            }
+        }
+
         return metadata;
     }
     catch (const json::parse_error&) {
@@ -106,6 +135,7 @@ InstrumentMetadata InstrumentMetadata::createDefault(const juce::String& fallbac
     metadata.description = "No description available";
     metadata.category = "Unknown";
     metadata.sampleCount = 0;
+    metadata.hasReleaseTriggers = false;
     return metadata;
 }
 
@@ -121,6 +151,13 @@ bool InstrumentMetadata::saveToFile(const juce::File& jsonFilePath) const
         j["category"] = category.toStdString();
         j["sampleCount"] = sampleCount;
 
+        if (hasReleaseTriggers) {
+            j["releaseTriggers"] = {
+                { "directory", releaseTriggerDirectory.toStdString() },
+                { "voices", releaseTriggerVoices }
+            };
+        }
+
         // Zapsat do souboru s odsazením
         std::ofstream file(jsonFilePath.getFullPathName().toStdString());
         if (!file.is_open()) {
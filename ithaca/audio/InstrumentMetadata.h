@@ -27,6 +27,11 @@ struct InstrumentMetadata {
     juce::String category;              // Kategorie (Piano, Synth, etc.)
     int sampleCount = 0;                // Počet samplů (optional)
 
+    // Release-trigger samply (key-up zvuky) - volitelné
+    bool hasReleaseTriggers = false;    // true pokud JSON obsahuje "releaseTriggers"
+    juce::String releaseTriggerDirectory;  // Podadresář s <MIDI_nota>.wav soubory
+    int releaseTriggerVoices = 16;      // Velikost release voice poolu (1-ITHACA_MAX_RELEASE_VOICES)
+
     /**
      * @brief Načte metadata z JSON souboru
      * @param jsonFilePath Cesta k instrument-definition.json
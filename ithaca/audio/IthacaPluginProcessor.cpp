@@ -5,8 +5,12 @@
 
 #include "ithaca/audio/IthacaPluginProcessor.h"
 #include "ithaca/audio/SampleBankPathManager.h"
+#include "ithaca/audio/SharedEnvelopeData.h"
 #include "ithaca/gui/IthacaPluginEditor.h"
+#include <algorithm>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 
 //==============================================================================
@@ -108,6 +112,41 @@ IthacaPluginProcessor::IthacaPluginProcessor()
         logger_->log("IthacaPluginProcessor/constructor", LogSeverity::Info, "Performance Monitor created");
     }
 
+    // Create Engine Metrics
+    engineMetrics_ = std::make_unique<EngineMetrics>();
+
+    // Create DSP tail gate
+    dspTailGate_ = std::make_unique<DspTailGate>();
+
+    // Create output true-peak limiter
+    truePeakLimiter_ = std::make_unique<TruePeakLimiter>();
+
+    // Message-thread housekeeping (retired release pools, metrics log)
+    lastMetricsDumpMs_ = juce::Time::getMillisecondCounter();
+    startTimer(Constants::Audio::Housekeeping::TIMER_INTERVAL_MS);
+
+    // Opt-in periodic metrics log (ITHACA_METRICS=1) for fleet monitoring
+    if (const char* metricsEnv = std::getenv("ITHACA_METRICS"); metricsEnv && std::string(metricsEnv) == "1") {
+        metricsLogPath_ = (SampleBankPathManager::getPluginDataDirectory() /
+                           Constants::Performance::Metrics::LOG_FILE_NAME).string();
+        if (logger_) {
+            logger_->log("IthacaPluginProcessor/constructor", LogSeverity::Info,
+                       "Metrics log enabled: " + metricsLogPath_);
+        }
+    }
+
+    // Opt-in timeline tracing (ITHACA_TRACE=1), dumped on shutdown
+    if (const char* traceEnv = std::getenv("ITHACA_TRACE"); traceEnv && std::string(traceEnv) == "1") {
+        TraceRecorder::instance().setEnabled(true);
+        if (logger_) {
+            logger_->log("IthacaPluginProcessor/constructor", LogSeverity::Info,
+                       "Timeline tracing enabled (ITHACA_TRACE=1)");
+        }
+    }
+
+    // Envelope tables are process-wide - this instance holds a reference until destruction
+    SharedEnvelopeData::acquire(*logger_);
+
     // Initialize with sine waves immediately (fast, non-blocking)
     // Sample bank will be loaded later via GUI folder picker
     if (logger_) {
@@ -151,6 +190,9 @@ IthacaPluginProcessor::~IthacaPluginProcessor()
         logger_->log("IthacaPluginProcessor/destructor", LogSeverity::Info, "=== ITHACA PLUGIN SHUTTING DOWN ===");
     }
 
+    stopTimer();
+    freeRetiredReleasePool();
+
     // Stop any ongoing async loading first
     if (asyncLoader_) {
         if (logger_) {
@@ -184,10 +226,24 @@ IthacaPluginProcessor::~IthacaPluginProcessor()
         }
     }
 
-    // Cleanup envelope static data
-    EnvelopeStaticData::cleanup();
+    // Write timeline trace (Chrome Trace Event JSON, open in ui.perfetto.dev)
+    if (TraceRecorder::instance().isEnabled()) {
+        const auto tracePath = SampleBankPathManager::getPluginDataDirectory() /
+            ("ithaca-trace-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S").toStdString() + ".json");
+        const bool written = TraceRecorder::instance().dumpToFile(tracePath.string());
+        if (logger_) {
+            logger_->log("IthacaPluginProcessor/destructor", written ? LogSeverity::Info : LogSeverity::Warning,
+                       (written ? "Timeline trace written: " : "Failed to write timeline trace: ") + tracePath.string());
+        }
+    }
+
+    // Release envelope tables - freed only with the last plugin instance in the process
+    const bool envelopeDataFreed = SharedEnvelopeData::release();
     if (logger_) {
-        logger_->log("IthacaPluginProcessor/destructor", LogSeverity::Info, "Envelope data cleaned up");
+        logger_->log("IthacaPluginProcessor/destructor", LogSeverity::Info,
+                   envelopeDataFreed ? "Envelope data cleaned up (last instance)"
+                                     : "Envelope data still shared by " +
+                                       std::to_string(SharedEnvelopeData::getReferenceCount()) + " instance(s)");
     }
 
     if (logger_) {
@@ -243,6 +299,30 @@ void IthacaPluginProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     if (perfMonitor_) {
         perfMonitor_->setAudioSettings(sampleRate, samplesPerBlock);
     }
+    if (engineMetrics_) {
+        engineMetrics_->setSampleRate(sampleRate);
+    }
+    if (dspTailGate_) {
+        dspTailGate_->setSampleRate(sampleRate);
+    }
+
+    // Output limiter look-ahead is plugin latency - report it to the host
+    if (truePeakLimiter_) {
+        truePeakLimiter_->prepare(sampleRate);
+        truePeakLimiterActive_ = parameterManager_.isTruePeakLimiterEnabled();
+        reportedLatencySamples_ = truePeakLimiterActive_ ? truePeakLimiter_->getLatencySamples() : 0;
+        setLatencySamples(reportedLatencySamples_);
+        if (logger_ && truePeakLimiterActive_) {
+            logger_->log("IthacaPluginProcessor/prepareToPlay", LogSeverity::Info,
+               "True-peak limiter enabled (latency " +
+               std::to_string(truePeakLimiter_->getLatencySamples()) + " samples)");
+        }
+    }
+
+    // Loads in flight (or finished, not yet transferred) follow the live block size
+    if (asyncLoader_) {
+        asyncLoader_->setBlockSize(samplesPerBlock);
+    }
 
     // If already initialized, just update settings
     if (samplerInitialized_ && voiceManager_) {
@@ -262,6 +342,10 @@ void IthacaPluginProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 
             if (asyncLoader_->getState() == AsyncSampleLoader::LoadingState::Completed) {
                 voiceManager_ = asyncLoader_->takeVoiceManager();
+                releasePool_ = asyncLoader_->takeReleaseTriggerPool();  // Old rate - dropped
+                if (midiProcessor_) {
+                    midiProcessor_->getPedalProcessor().setReleaseTriggerPool(releasePool_.get());
+                }
                 samplerInitialized_ = true;
 
                 // If we had a sample bank loaded, reload it
@@ -283,8 +367,9 @@ void IthacaPluginProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
                     logger_->log("IthacaPluginProcessor/prepareToPlay", LogSeverity::Info,
                                "Restored sample bank path found - auto-loading: " + loadedSampleBankPath_.toStdString());
                 }
-                // Always load the saved sample bank path
-                // AsyncSampleLoader will handle graceful swap from sine waves or existing bank
+                // AsyncSampleLoader skips the request if this bank (path, rate, content)
+                // is already resident or loading, otherwise swaps gracefully from
+                // sine waves or the existing bank
                 asyncLoader_->loadSampleBankAsync(loadedSampleBankPath_.toStdString(), *logger_);
             } else {
                 if (logger_) {
@@ -325,11 +410,44 @@ void IthacaPluginProcessor::releaseResources()
 {
     if (logger_) {
         logger_->log("IthacaPluginProcessor/releaseResources", LogSeverity::Info, "=== RELEASING AUDIO RESOURCES ===");
+
+        // Stage breakdown of the session that just ended (headless runs read it from the log)
+        if (perfMonitor_) {
+            auto breakdown = perfMonitor_->getStageBreakdown();
+            if (breakdown.blocks > 0) {
+                logger_->log("IthacaPluginProcessor/releaseResources", LogSeverity::Info,
+                   "Stage timing over " + std::to_string(breakdown.blocks) + " blocks: " +
+                   PerformanceMonitor::formatStageBreakdown(breakdown));
+            }
+
+            auto xruns = perfMonitor_->getMetrics().xruns;
+            if (xruns.callbacks > 0) {
+                logger_->log("IthacaPluginProcessor/releaseResources", LogSeverity::Info,
+                   "Xruns over " + std::to_string(xruns.callbacks) + " callbacks: late=" +
+                   std::to_string(xruns.lateCallbacks) + " missed=" + std::to_string(xruns.missedCallbacks) +
+                   " budget=" + std::to_string(xruns.budgetOverruns) +
+                   " maxLateness=" + std::to_string(xruns.maxLatenessMs) + "ms");
+            }
+
+            std::array<XrunDetector::Event, XrunDetector::EVENT_RING_SIZE> events;
+            const int eventCount = perfMonitor_->getRecentXruns(events.data(), static_cast<int>(events.size()));
+            for (int i = 0; i < eventCount; ++i) {
+                const auto& event = events[static_cast<size_t>(i)];
+                logger_->log("IthacaPluginProcessor/releaseResources", LogSeverity::Warning,
+                   std::string("Xrun: ") + XrunDetector::getTypeName(event.type) +
+                   " at " + juce::Time(event.wallClockUs / 1000).toString(true, true, true, true).toStdString() +
+                   " (block " + std::to_string(event.blockIndex) + ", " + std::to_string(event.measuredMs) +
+                   " ms > " + std::to_string(event.limitMs) + " ms)");
+            }
+        }
     }
 
     if (voiceManager_) {
         voiceManager_->setRealTimeMode(false);
         voiceManager_->stopAllVoices();
+        if (releasePool_) {
+            releasePool_->stopAll();
+        }
         if (logger_) {
             logger_->log("IthacaPluginProcessor/releaseResources", LogSeverity::Info, "All voices stopped");
         }
@@ -351,10 +469,17 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                                          juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    ITHACA_TRACE_THREAD("Audio");
+    ITHACA_TRACE_SCOPE("processBlock");
 
-    // Start performance measurement
+    // Read per block - VST2/AU wrappers switch non-realtime at render time
+    // without calling prepareToPlay() again
+    const bool nonRealtime = isNonRealtime();
+
+    // Start performance measurement (no xrun deadlines while the host renders offline)
     if (perfMonitor_) {
-        perfMonitor_->startMeasurement();
+        perfMonitor_->setNonRealtime(nonRealtime);
+        perfMonitor_->startMeasurement(buffer.getNumSamples());
     }
 
     // Increment process block counter
@@ -364,7 +489,10 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     buffer.clear();
 
     // Check if async loading has completed and transfer VoiceManager
-    checkAndTransferVoiceManager();
+    {
+        PerformanceMonitor::ScopedStage probe(perfMonitor_.get(), PerformanceMonitor::Stage::Transfer);
+        checkAndTransferVoiceManager();
+    }
 
     // If not initialized, return silence
     if (!samplerInitialized_ || !voiceManager_) {
@@ -375,8 +503,39 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         return;  // Silent output during loading
     }
 
+    // Engine asleep (no voices, DSP tail decayed): keep MIDI state current,
+    // skip parameters, rendering and the DSP chain until something can sound
+    if (dspTailGate_ && dspTailGate_->isBypassed() && !canWakeEngine(midiMessages)) {
+        ITHACA_TRACE_SCOPE("asleep");
+        const int asleepEventsBefore = midiProcessor_ ? midiProcessor_->getTotalMidiEventsProcessed() : 0;
+        if (midiProcessor_) {
+            for (const auto& midiMetadata : midiMessages) {
+                midiProcessor_->processSingleEvent(midiMetadata.getMessage(), voiceManager_.get(),
+                                                   parameters_, midiLearnManager_.get());
+            }
+        }
+
+        if (engineMetrics_) {
+            EngineMetrics::BlockStats blockStats;
+            blockStats.numSamples = buffer.getNumSamples();
+            blockStats.midiEvents = midiProcessor_ ? midiProcessor_->getTotalMidiEventsProcessed() - asleepEventsBefore : 0;
+            engineMetrics_->recordBlock(blockStats);
+        }
+
+        if (perfMonitor_) {
+            perfMonitor_->endMeasurement();
+        }
+        return;
+    }
+
     // Update VoiceManager parameters (RT-safe through ParameterManager)
-    parameterManager_.updateSamplerParametersRTSafe(voiceManager_.get());
+    // Release and master gain go through the pedal processor so half-pedal
+    // scaling and una corda attenuation stay applied
+    PedalProcessor* pedals = midiProcessor_ ? &midiProcessor_->getPedalProcessor() : nullptr;
+    {
+        PerformanceMonitor::ScopedStage probe(perfMonitor_.get(), PerformanceMonitor::Stage::Parameters);
+        parameterManager_.updateSamplerParametersRTSafe(voiceManager_.get(), pedals);
+    }
 
     // Sample-accurate MIDI processing:
     // Render audio up to each MIDI event's sample position, then apply the event.
@@ -387,22 +546,25 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     float* right = buffer.getWritePointer(1);
     const int totalSamples = buffer.getNumSamples();
     int currentSample = 0;
+    int noteOns = 0;
+    const int midiEventsBefore = midiProcessor_ ? midiProcessor_->getTotalMidiEventsProcessed() : 0;
 
     for (const auto& midiMetadata : midiMessages) {
         const int eventSample = juce::jlimit(0, totalSamples, midiMetadata.samplePosition);
 
         // Render audio segment up to this event
         if (eventSample > currentSample && voiceManager_) {
-            voiceManager_->processBlockSegment(
-                left  + currentSample,
-                right + currentSample,
-                eventSample - currentSample
-            );
+            renderSegment(left + currentSample, right + currentSample, eventSample - currentSample);
             currentSample = eventSample;
         }
 
         // Apply MIDI event at its correct position
         if (midiProcessor_) {
+            if (midiMetadata.getMessage().isNoteOn()) {
+                ++noteOns;
+            }
+
+            PerformanceMonitor::ScopedStage probe(perfMonitor_.get(), PerformanceMonitor::Stage::Midi);
             midiProcessor_->processSingleEvent(
                 midiMetadata.getMessage(),
                 voiceManager_.get(),
@@ -414,16 +576,50 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 
     // Render remaining audio after last MIDI event
     if (currentSample < totalSamples && voiceManager_) {
-        voiceManager_->processBlockSegment(
-            left  + currentSample,
-            right + currentSample,
-            totalSamples - currentSample
-        );
+        renderSegment(left + currentSample, right + currentSample, totalSamples - currentSample);
     }
 
     // Apply LFO panning and DSP chain to the complete block
-    if (voiceManager_) {
-        voiceManager_->finalizeBlock(left, right, totalSamples);
+    // (skipped while no voice renders and the chain's tail has decayed)
+    const bool inputActive = voiceManager_ &&
+        (voiceManager_->getActiveVoicesCount() > 0 || (releasePool_ && releasePool_->getActiveVoiceCount() > 0));
+
+    // Limiter toggled by host/GUI - start again from an empty delay line
+    // (latency is reported to the host from timerCallback)
+    if (const bool limiterEnabled = parameterManager_.isTruePeakLimiterEnabled();
+        limiterEnabled != truePeakLimiterActive_ && truePeakLimiter_) {
+        truePeakLimiterActive_ = limiterEnabled;
+        truePeakLimiter_->reset();
+    }
+
+    if (voiceManager_ && (!dspTailGate_ || dspTailGate_->needsProcessing(inputActive))) {
+        PerformanceMonitor::ScopedStage probe(perfMonitor_.get(), PerformanceMonitor::Stage::Finalize);
+        ITHACA_TRACE_SCOPE("finalizeBlock");
+        const int maxSegment = currentBlockSize_ > 0 ? currentBlockSize_ : totalSamples;
+        for (int offset = 0; offset < totalSamples; offset += maxSegment) {
+            voiceManager_->finalizeBlock(left + offset, right + offset, std::min(maxSegment, totalSamples - offset));
+        }
+
+        if (truePeakLimiterActive_ && truePeakLimiter_) {
+            truePeakLimiter_->process(left, right, totalSamples);
+        }
+
+        if (dspTailGate_ && !inputActive) {
+            dspTailGate_->observeTail(left, right, totalSamples);
+        }
+    }
+
+    // Engine load metrics (lock-free publish)
+    if (engineMetrics_ && voiceManager_) {
+        EngineMetrics::BlockStats blockStats;
+        blockStats.numSamples = totalSamples;
+        blockStats.activeVoices = voiceManager_->getActiveVoicesCount();
+        blockStats.sustainingVoices = voiceManager_->getSustainingVoicesCount();
+        blockStats.releasingVoices = voiceManager_->getReleasingVoicesCount();
+        blockStats.releaseTriggerVoices = releasePool_ ? releasePool_->getActiveVoiceCount() : 0;
+        blockStats.midiEvents = midiProcessor_ ? midiProcessor_->getTotalMidiEventsProcessed() - midiEventsBefore : 0;
+        blockStats.noteOns = noteOns;
+        engineMetrics_->recordBlock(blockStats);
     }
 
     // End performance measurement
@@ -432,6 +628,40 @@ void IthacaPluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     }
 }
 
+bool IthacaPluginProcessor::canWakeEngine(const juce::MidiBuffer& midiMessages)
+{
+    for (const auto& midiMetadata : midiMessages) {
+        const auto& message = midiMetadata.getMessage();
+        if (message.isNoteOnOrOff()) {
+            return true;  // Note-on starts a voice, note-off may fire a release trigger
+        }
+        if (message.isController()) {
+            const int cc = message.getControllerNumber();
+            if (cc == Constants::Midi::CC::DAMPER_PEDAL || cc == Constants::Midi::CC::SOSTENUTO) {
+                return true;  // Pedal release may fire release triggers
+            }
+        }
+    }
+    return false;
+}
+
+void IthacaPluginProcessor::renderSegment(float* left, float* right, int numSamples)
+{
+    PerformanceMonitor::ScopedStage probe(perfMonitor_.get(), PerformanceMonitor::Stage::Render);
+
+    // Hosts may exceed the announced block size - never hand VoiceManager more
+    // than it was prepared for, so its buffers are not resized on this thread
+    const int maxSegment = currentBlockSize_ > 0 ? currentBlockSize_ : numSamples;
+    for (int offset = 0; offset < numSamples; offset += maxSegment) {
+        const int count = std::min(maxSegment, numSamples - offset);
+        voiceManager_->processBlockSegment(left + offset, right + offset, count);
+
+        if (releasePool_) {
+            releasePool_->renderSegment(left + offset, right + offset, count);
+        }
+    }
+}
+
 //==============================================================================
 // Editor Management
 
@@ -450,6 +680,8 @@ bool IthacaPluginProcessor::hasEditor() const
 
 void IthacaPluginProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
+    ITHACA_TRACE_SCOPE("getStateInformation");
+
     // Delegate to PluginStateManager
     auto logCallback = [this](const std::string& component,
                               LogSeverity severity,
@@ -466,6 +698,8 @@ void IthacaPluginProcessor::getStateInformation(juce::MemoryBlock& destData)
 
 void IthacaPluginProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    ITHACA_TRACE_SCOPE("setStateInformation");
+
     // Delegate to PluginStateManager
     auto logCallback = [this](const std::string& component,
                               LogSeverity severity,
@@ -529,12 +763,81 @@ IthacaPluginProcessor::SamplerStats IthacaPluginProcessor::getSamplerStats() con
         stats.maxProcessingTimeMs = perfMetrics.maxProcessingTimeMs;
         stats.cpuUsagePercent = perfMetrics.cpuUsagePercent;
         stats.dropoutCount = perfMetrics.dropoutCount;
+        stats.lateCallbacks = static_cast<int>(perfMetrics.xruns.lateCallbacks);
+        stats.missedCallbacks = static_cast<int>(perfMetrics.xruns.missedCallbacks);
         stats.isDropoutRisk = perfMetrics.isDropoutRisk;
+        stats.p50ProcessingTimeMs = perfMetrics.latency.p50Ms;
+        stats.p95ProcessingTimeMs = perfMetrics.latency.p95Ms;
+        stats.p99ProcessingTimeMs = perfMetrics.latency.p99Ms;
+        stats.p999ProcessingTimeMs = perfMetrics.latency.p999Ms;
+        stats.stageBreakdown = perfMonitor_->getStageBreakdown();
     }
 
+    stats.engineAsleep = dspTailGate_ && dspTailGate_->isBypassed();
+
     return stats;
 }
 
+EngineMetrics::Snapshot IthacaPluginProcessor::getEngineMetrics() const
+{
+    EngineMetrics::Snapshot snapshot;
+    if (engineMetrics_) {
+        snapshot = engineMetrics_->getSnapshot();
+    }
+
+    if (asyncLoader_) {
+        const auto progress = asyncLoader_->getLoadProgress();
+        snapshot.residentSampleBytes = progress.residentBytes;
+        snapshot.filesTotal = progress.filesTotal;
+        snapshot.filesLoaded = progress.filesLoaded;
+        snapshot.bytesTotal = progress.bytesTotal;
+        snapshot.bytesLoaded = progress.bytesLoaded;
+        snapshot.diskBytesPerSecond = progress.bytesPerSecond;
+    }
+
+    return snapshot;
+}
+
+void IthacaPluginProcessor::freeRetiredReleasePool()
+{
+    delete retiredReleasePool_.exchange(nullptr, std::memory_order_acquire);
+}
+
+void IthacaPluginProcessor::timerCallback()
+{
+    freeRetiredReleasePool();
+
+    // Limiter look-ahead is plugin latency - hosts re-query it after updateHostDisplay
+    if (truePeakLimiter_) {
+        const int latency = parameterManager_.isTruePeakLimiterEnabled() ? truePeakLimiter_->getLatencySamples() : 0;
+        if (latency != reportedLatencySamples_) {
+            reportedLatencySamples_ = latency;
+            setLatencySamples(latency);
+            updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withLatencyChanged(true));
+            if (logger_) {
+                logger_->log("IthacaPluginProcessor/timerCallback", LogSeverity::Info,
+                   "True-peak limiter " + std::string(latency > 0 ? "enabled" : "disabled") +
+                   " (latency " + std::to_string(latency) + " samples)");
+            }
+        }
+    }
+
+    if (metricsLogPath_.empty()) {
+        return;
+    }
+
+    const auto now = juce::Time::getMillisecondCounter();
+    if (now - lastMetricsDumpMs_ < static_cast<juce::uint32>(Constants::Performance::Metrics::DUMP_INTERVAL_MS)) {
+        return;
+    }
+    lastMetricsDumpMs_ = now;
+
+    std::ofstream out(metricsLogPath_, std::ios::app);
+    if (out.is_open()) {
+        out << EngineMetrics::toJsonLine(getEngineMetrics(), getInstrumentName().toStdString()) << '\n';
+    }
+}
+
 juce::String IthacaPluginProcessor::getInstrumentName() const
 {
     if (asyncLoader_) {
@@ -663,6 +966,11 @@ bool IthacaPluginProcessor::isLoadingInProgress() const
     return asyncLoader_ && asyncLoader_->isInProgress();
 }
 
+AsyncSampleLoader::LoadProgress IthacaPluginProcessor::getLoadProgress() const
+{
+    return asyncLoader_ ? asyncLoader_->getLoadProgress() : AsyncSampleLoader::LoadProgress();
+}
+
 bool IthacaPluginProcessor::hasLoadingError() const
 {
     return asyncLoader_ && asyncLoader_->hasError();
@@ -681,10 +989,13 @@ std::string IthacaPluginProcessor::getLoadingErrorMessage() const
 
 void IthacaPluginProcessor::checkAndTransferVoiceManager()
 {
-    // Check if loading completed and there's a new VoiceManager ready
+    // Check if loading completed and there's a new VoiceManager ready.
+    // The previous release pool must leave through the retire slot (never freed
+    // here) - while the message thread has not emptied it yet, the swap waits.
     if (asyncLoader_ &&
         asyncLoader_->getState() == AsyncSampleLoader::LoadingState::Completed &&
-        asyncLoader_->hasVoiceManager()) {
+        asyncLoader_->hasVoiceManager() &&
+        (!releasePool_ || retiredReleasePool_.load(std::memory_order_relaxed) == nullptr)) {
 
         if (logger_) {
             logger_->log("IthacaPluginProcessor/checkAndTransfer", LogSeverity::Info,
@@ -696,11 +1007,30 @@ void IthacaPluginProcessor::checkAndTransferVoiceManager()
         }
 
         // Transfer ownership of new VoiceManager (replaces old one if exists)
+        ITHACA_TRACE_INSTANT("VoiceManager swap");
         voiceManager_ = asyncLoader_->takeVoiceManager();
+        if (releasePool_) {
+            retiredReleasePool_.store(releasePool_.release(), std::memory_order_release);
+        }
+        releasePool_ = asyncLoader_->takeReleaseTriggerPool();
+        if (midiProcessor_) {
+            // Unconditionally - the previous pool was just retired
+            midiProcessor_->getPedalProcessor().setReleaseTriggerPool(releasePool_.get());
+        }
+        if (dspTailGate_) {
+            dspTailGate_->reset();  // New chain state - verify its tail again
+        }
 
         if (voiceManager_) {
             samplerInitialized_ = true;
 
+            // Note latches refer to the previous VoiceManager; pedal states carry over
+            if (midiProcessor_) {
+                auto& pedals = midiProcessor_->getPedalProcessor();
+                pedals.reset(voiceManager_.get());
+                pedals.setVelocityLayerCount(asyncLoader_->getVelocityLayerCount());
+            }
+
             if (logger_) {
                 logger_->log("IthacaPluginProcessor/checkAndTransfer", LogSeverity::Info,
                    "VoiceManager transferred successfully");
@@ -20,9 +20,14 @@
 
 // Async loading
 #include "ithaca/audio/AsyncSampleLoader.h"
+#include "ithaca/audio/ReleaseTriggerPool.h"
 
 // Performance monitoring
 #include "ithaca/audio/PerformanceMonitor.h"
+#include "ithaca/audio/EngineMetrics.h"
+#include "ithaca/audio/DspTailGate.h"
+#include "ithaca/audio/TruePeakLimiter.h"
+#include "ithaca/audio/TraceRecorder.h"
 
 // State management
 #include "ithaca/audio/PluginStateManager.h"
@@ -69,7 +74,8 @@
  * - createEditor/state management are main thread
  * - Async loading runs in dedicated background thread
  */
-class IthacaPluginProcessor final : public juce::AudioProcessor
+class IthacaPluginProcessor final : public juce::AudioProcessor,
+                                    private juce::Timer
 {
 public:
     //==============================================================================
@@ -139,11 +145,30 @@ public:
         double avgProcessingTimeMs = 0.0;
         double maxProcessingTimeMs = 0.0;
         double cpuUsagePercent = 0.0;
-        int dropoutCount = 0;
+        int dropoutCount = 0;           ///< Blocks over the engine time budget
+        int lateCallbacks = 0;          ///< Host callbacks that started late
+        int missedCallbacks = 0;        ///< Buffer periods skipped by the host
         bool isDropoutRisk = false;
+
+        // Tail latency of processBlock (rolling histogram window)
+        double p50ProcessingTimeMs = 0.0;
+        double p95ProcessingTimeMs = 0.0;
+        double p99ProcessingTimeMs = 0.0;
+        double p999ProcessingTimeMs = 0.0;
+
+        // Where block time goes (averages since last reset)
+        PerformanceMonitor::StageBreakdown stageBreakdown;
+
+        bool engineAsleep = false;      ///< Idle: no voices, DSP tail decayed
     };
     SamplerStats getSamplerStats() const;
 
+    /**
+     * @brief Engine load metrics (voices, note rate, MIDI traffic, memory, loader)
+     * @note Lock-free, can be called from GUI thread
+     */
+    EngineMetrics::Snapshot getEngineMetrics() const;
+
     /**
      * @brief Get loaded instrument name from metadata
      * @return Instrument name (empty string if not loaded)
@@ -210,6 +235,13 @@ public:
      */
     std::string getLoadingErrorMessage() const;
 
+    /**
+     * @brief Get progress of the running (or last) load
+     * @return Phase, bank totals and files/bytes done
+     * @note Lock-free, can be called from GUI thread
+     */
+    AsyncSampleLoader::LoadProgress getLoadProgress() const;
+
     //==============================================================================
     // Parameter Management - Public API
     
@@ -248,10 +280,17 @@ private:
     
     std::unique_ptr<Logger> logger_;                    // IthacaCore logger
     std::unique_ptr<VoiceManager> voiceManager_;        // IthacaCore voice manager
+    std::unique_ptr<ReleaseTriggerPool> releasePool_;   // Release-trigger voices (optional, per bank)
+    std::atomic<ReleaseTriggerPool*> retiredReleasePool_ { nullptr }; // Swapped-out pool, freed on message thread
     std::unique_ptr<AsyncSampleLoader> asyncLoader_;    // Async sample loader
     std::unique_ptr<MidiProcessor> midiProcessor_;      // MIDI event processor
     std::unique_ptr<MidiLearnManager> midiLearnManager_; // MIDI Learn manager
     std::unique_ptr<PerformanceMonitor> perfMonitor_;   // Performance monitor
+    std::unique_ptr<EngineMetrics> engineMetrics_;      // Engine load metrics
+    std::unique_ptr<DspTailGate> dspTailGate_;          // Skips finalizeBlock while chain is at rest
+    std::unique_ptr<TruePeakLimiter> truePeakLimiter_;  // Output true-peak limiter ("truePeakLimiter" parameter)
+    bool truePeakLimiterActive_ = false;                // Audio thread: limiter state of the last block
+    int reportedLatencySamples_ = 0;                    // Message thread: latency last reported to the host
     
     //==============================================================================
     // Parameter Management (delegated to ParameterManager)
@@ -276,6 +315,8 @@ private:
     // Performance Monitoring
     
     mutable std::atomic<int> processBlockCallCount_;    // Process block counter
+    std::string metricsLogPath_;                        // JSON-line metrics log (empty = disabled)
+    juce::uint32 lastMetricsDumpMs_ = 0;                // Millisecond counter of the last metrics line
 
     //==============================================================================
     // Private Methods - Audio Processing
@@ -286,6 +327,31 @@ private:
      */
     void checkAndTransferVoiceManager();
 
+    /**
+     * @brief Check whether a block contains MIDI that can make the engine sound
+     * @return true for note on/off and sustain/sostenuto pedal events
+     * @note Audio thread - decides whether a sleeping engine wakes up
+     */
+    static bool canWakeEngine(const juce::MidiBuffer& midiMessages);
+
+    /**
+     * @brief Render one sample-accurate segment (voices + release triggers)
+     * @note Audio thread only, voiceManager_ must be valid
+     */
+    void renderSegment(float* left, float* right, int numSamples);
+
+    /**
+     * @brief Delete the release pool retired by the audio thread (message thread)
+     */
+    void freeRetiredReleasePool();
+
+    /**
+     * @brief Message-thread housekeeping: free retired pools, report latency
+     *        after a limiter toggle, append one metrics JSON line every
+     *        DUMP_INTERVAL_MS (ITHACA_METRICS=1)
+     */
+    void timerCallback() override;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IthacaPluginProcessor)
 };
\ No newline at end of file
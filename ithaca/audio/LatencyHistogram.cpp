@@ -0,0 +1,177 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Implementation of the lock-free log-bucket latency histogram
+ */
+
+#include "ithaca/audio/LatencyHistogram.h"
+#include <algorithm>
+
+//==============================================================================
+// Counts
+
+LatencyHistogram::Counts::Counts()
+{
+    clear();
+}
+
+void LatencyHistogram::Counts::clear()
+{
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    maxMicros.store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::Counts::add(int bucket, uint32_t microseconds)
+{
+    // Single writer - load/store is enough, no RMW needed
+    auto& slot = buckets[static_cast<size_t>(bucket)];
+    slot.store(slot.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (microseconds > maxMicros.load(std::memory_order_relaxed)) {
+        maxMicros.store(microseconds, std::memory_order_relaxed);
+    }
+}
+
+//==============================================================================
+// Constructor / Configuration
+
+LatencyHistogram::LatencyHistogram(int windowSize)
+    : windowSize_(std::max(1, windowSize))
+{
+}
+
+void LatencyHistogram::setWindowSize(int windowSize)
+{
+    windowSize_.store(std::max(1, windowSize));
+}
+
+void LatencyHistogram::reset()
+{
+    resetRequested_.store(true, std::memory_order_release);
+}
+
+//==============================================================================
+// Recording (audio thread)
+
+void LatencyHistogram::record(uint32_t microseconds)
+{
+    if (resetRequested_.exchange(false, std::memory_order_acquire)) {
+        window_[0].clear();
+        window_[1].clear();
+        total_.clear();
+        activeSlot_.store(0, std::memory_order_relaxed);
+        recordsInSlot_ = 0;
+    }
+
+    // Rotate window: the older slot is cleared and becomes the active one
+    if (recordsInSlot_ >= windowSize_.load(std::memory_order_relaxed)) {
+        const int next = 1 - activeSlot_.load(std::memory_order_relaxed);
+        window_[static_cast<size_t>(next)].clear();
+        activeSlot_.store(next, std::memory_order_release);
+        recordsInSlot_ = 0;
+    }
+
+    const int bucket = bucketIndex(microseconds);
+    window_[static_cast<size_t>(activeSlot_.load(std::memory_order_relaxed))].add(bucket, microseconds);
+    total_.add(bucket, microseconds);
+    ++recordsInSlot_;
+}
+
+//==============================================================================
+// Query (any thread)
+
+LatencyHistogram::Percentiles LatencyHistogram::getPercentiles(Scope scope) const
+{
+    std::array<uint32_t, NUM_BUCKETS> merged {};
+    uint64_t count = 0;
+    uint32_t maxMicros = 0;
+
+    auto accumulate = [&](const Counts& counts) {
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            merged[static_cast<size_t>(i)] += counts.buckets[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+        }
+        count += counts.count.load(std::memory_order_relaxed);
+        maxMicros = std::max(maxMicros, counts.maxMicros.load(std::memory_order_relaxed));
+    };
+
+    if (scope == Scope::Window) {
+        accumulate(window_[0]);
+        accumulate(window_[1]);
+    } else {
+        accumulate(total_);
+    }
+
+    Percentiles result;
+    result.count = count;
+    result.maxMs = maxMicros / 1000.0;
+    result.p50Ms = valueAtPercentile(merged.data(), count, maxMicros, 50.0);
+    result.p95Ms = valueAtPercentile(merged.data(), count, maxMicros, 95.0);
+    result.p99Ms = valueAtPercentile(merged.data(), count, maxMicros, 99.0);
+    result.p999Ms = valueAtPercentile(merged.data(), count, maxMicros, 99.9);
+    return result;
+}
+
+double LatencyHistogram::getWindowMaxMs() const
+{
+    const uint32_t maxMicros = std::max(window_[0].maxMicros.load(std::memory_order_relaxed),
+                                        window_[1].maxMicros.load(std::memory_order_relaxed));
+    return maxMicros / 1000.0;
+}
+
+//==============================================================================
+// Bucket Mapping
+
+int LatencyHistogram::bucketIndex(uint32_t microseconds)
+{
+    if (microseconds < SUB_BUCKETS) {
+        return static_cast<int>(microseconds);  // Linear region (0-7 µs)
+    }
+
+    int exponent = 31;
+    while ((microseconds >> exponent) == 0) {
+        --exponent;
+    }
+
+    const int octave = exponent - SUB_BUCKET_BITS + 1;
+    if (octave > OCTAVES) {
+        return NUM_BUCKETS - 1;  // Saturate
+    }
+
+    const int sub = static_cast<int>((microseconds >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return octave * SUB_BUCKETS + sub;
+}
+
+uint32_t LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < SUB_BUCKETS) {
+        return static_cast<uint32_t>(index + 1);
+    }
+
+    const int octave = index / SUB_BUCKETS;
+    const int sub = index % SUB_BUCKETS;
+    const int shift = octave - 1;
+    return static_cast<uint32_t>(SUB_BUCKETS + sub + 1) << shift;
+}
+
+double LatencyHistogram::valueAtPercentile(const uint32_t* buckets, uint64_t count,
+                                           uint32_t maxMicros, double percentile)
+{
+    if (count == 0) {
+        return 0.0;
+    }
+
+    const auto target = static_cast<uint64_t>(static_cast<double>(count) * percentile / 100.0 + 0.5);
+    uint64_t seen = 0;
+
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        seen += buckets[i];
+        if (seen >= std::max<uint64_t>(target, 1)) {
+            // Bucket upper bound, never above the exact observed maximum
+            return std::min(bucketUpperBound(i), maxMicros) / 1000.0;
+        }
+    }
+
+    return maxMicros / 1000.0;
+}
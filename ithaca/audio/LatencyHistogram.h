@@ -0,0 +1,122 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief Lock-free log-bucket latency histogram with percentile queries
+ *
+ * HDR-style layout: values are bucketed by power of two with a fixed number
+ * of linear sub-buckets per octave, so recording is O(1) and the relative
+ * error is bounded (1/SUB_BUCKETS) over the whole range.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class LatencyHistogram
+ * @brief Single-writer, multi-reader latency histogram
+ *
+ * Features:
+ * - O(1) record() from the audio thread (relaxed atomics, no locks)
+ * - Rolling window: two window slots, the writer rotates every N records,
+ *   readers merge both slots (covers the last N..2N records)
+ * - Total histogram since the last reset
+ * - reset() may be called from any thread - it is applied by the writer
+ *
+ * Readers see a statistically consistent snapshot; individual counters may be
+ * one record apart, which is fine for monitoring.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 3;                       ///< 8 sub-buckets per octave
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int OCTAVES = 24;                              ///< Up to ~2 minutes in microseconds
+    static constexpr int NUM_BUCKETS = SUB_BUCKETS * (OCTAVES + 1);
+
+    /**
+     * @enum Scope
+     * @brief Which records a query covers
+     */
+    enum class Scope {
+        Window,     ///< Last windowSize..2*windowSize records
+        Total       ///< Everything since the last reset
+    };
+
+    /**
+     * @struct Percentiles
+     * @brief Percentile snapshot in milliseconds
+     */
+    struct Percentiles {
+        double p50Ms = 0.0;
+        double p95Ms = 0.0;
+        double p99Ms = 0.0;
+        double p999Ms = 0.0;
+        double maxMs = 0.0;
+        uint64_t count = 0;
+    };
+
+    /**
+     * @brief Constructor
+     * @param windowSize Records per window slot
+     */
+    explicit LatencyHistogram(int windowSize);
+
+    /**
+     * @brief Change window size (takes effect on the next rotation)
+     */
+    void setWindowSize(int windowSize);
+
+    /**
+     * @brief Record one value (audio thread only, RT-safe)
+     * @param microseconds Measured latency
+     */
+    void record(uint32_t microseconds);
+
+    /**
+     * @brief Request a reset (any thread) - applied on the next record()
+     */
+    void reset();
+
+    /**
+     * @brief Compute percentiles (any thread)
+     */
+    Percentiles getPercentiles(Scope scope) const;
+
+    /**
+     * @brief Exact maximum of the rolling window in ms (O(1), any thread)
+     */
+    double getWindowMaxMs() const;
+
+    /**
+     * @brief Bucket index for a value (exposed for diagnostics)
+     */
+    static int bucketIndex(uint32_t microseconds);
+
+    /**
+     * @brief Upper bound (exclusive) of a bucket in microseconds
+     */
+    static uint32_t bucketUpperBound(int index);
+
+private:
+    struct Counts {
+        std::array<std::atomic<uint32_t>, NUM_BUCKETS> buckets;
+        std::atomic<uint32_t> count { 0 };
+        std::atomic<uint32_t> maxMicros { 0 };
+
+        Counts();
+        void clear();
+        void add(int bucket, uint32_t microseconds);
+    };
+
+    std::array<Counts, 2> window_;
+    Counts total_;
+
+    std::atomic<int> activeSlot_ { 0 };
+    std::atomic<int> windowSize_;
+    std::atomic<bool> resetRequested_ { false };
+    int recordsInSlot_ = 0;                     ///< Writer-only
+
+    static double valueAtPercentile(const uint32_t* buckets, uint64_t count,
+                                    uint32_t maxMicros, double percentile);
+};
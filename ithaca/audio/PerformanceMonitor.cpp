@@ -5,7 +5,7 @@
 
 #include "ithaca/audio/PerformanceMonitor.h"
 #include <algorithm>
-#include <numeric>
+#include <cstdio>
 
 //==============================================================================
 // Constructor / Destructor
@@ -16,14 +16,21 @@ PerformanceMonitor::PerformanceMonitor(double sampleRate, int bufferSize)
       availableTimeMs_(0.0),
       windowIndex_(0),
       windowFilled_(0),
+      windowSumUs_(0),
+      histogram_(Constants::Performance::HISTOGRAM_WINDOW_BLOCKS),
+      resetRequested_(false),
+      stageBlocks_(0),
+      stageBlockTotalNs_(0),
       avgProcessingTimeMs_(0.0),
       maxProcessingTimeMs_(0.0),
       cpuUsagePercent_(0.0),
       dropoutCount_(0),
       isDropoutRisk_(false)
 {
-    processingTimes_.fill(0.0);
+    processingTimesUs_.fill(0);
+    clearStageTotals();
     updateAvailableTime();
+    xruns_.setAudioSettings(sampleRate, bufferSize);
 }
 
 //==============================================================================
@@ -34,15 +41,21 @@ void PerformanceMonitor::setAudioSettings(double sampleRate, int bufferSize)
     sampleRate_.store(sampleRate);
     bufferSize_.store(bufferSize);
     updateAvailableTime();
+    xruns_.setAudioSettings(sampleRate, bufferSize);
+}
+
+void PerformanceMonitor::setHistogramWindowBlocks(int blocks)
+{
+    histogram_.setWindowSize(blocks);
 }
 
 void PerformanceMonitor::reset()
 {
-    std::lock_guard<std::mutex> lock(metricsMutex_);
+    // Window is owned by the audio thread - it clears it on the next block
+    resetRequested_.store(true);
+    histogram_.reset();
+    xruns_.reset();
 
-    processingTimes_.fill(0.0);
-    windowIndex_.store(0);
-    windowFilled_.store(0);
     avgProcessingTimeMs_.store(0.0);
     maxProcessingTimeMs_.store(0.0);
     cpuUsagePercent_.store(0.0);
@@ -53,20 +66,26 @@ void PerformanceMonitor::reset()
 //==============================================================================
 // Measurement
 
-void PerformanceMonitor::startMeasurement()
+void PerformanceMonitor::startMeasurement(int numSamples)
 {
-    measurementStart_ = std::chrono::high_resolution_clock::now();
+    measurementStart_ = std::chrono::steady_clock::now();
+    xruns_.onCallbackStart(measurementStart_, numSamples);
 }
 
 void PerformanceMonitor::endMeasurement()
 {
-    auto end = std::chrono::high_resolution_clock::now();
+    auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
         end - measurementStart_);
+    const int64_t durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - measurementStart_).count();
 
-    double processingTimeMs = duration.count() / 1000.0;
+    // Budget of this block's actual length (hosts may call with fewer samples)
+    if (xruns_.onCallbackEnd(durationNs)) {
+        dropoutCount_.fetch_add(1);
+    }
 
-    updateStatistics(processingTimeMs);
+    publishStageTimes(durationNs);
+    updateStatistics(static_cast<uint32_t>(std::max<std::chrono::microseconds::rep>(0, duration.count())));
 }
 
 //==============================================================================
@@ -81,13 +100,104 @@ PerformanceMonitor::PerformanceMetrics PerformanceMonitor::getMetrics() const
     metrics.cpuUsagePercent = cpuUsagePercent_.load();
     metrics.dropoutCount = dropoutCount_.load();
     metrics.isDropoutRisk = isDropoutRisk_.load();
+    metrics.latency = histogram_.getPercentiles(LatencyHistogram::Scope::Window);
+    metrics.xruns = xruns_.getCounters();
 
     return metrics;
 }
 
+LatencyHistogram::Percentiles PerformanceMonitor::getLatencyPercentiles(LatencyHistogram::Scope scope) const
+{
+    return histogram_.getPercentiles(scope);
+}
+
+int PerformanceMonitor::getRecentXruns(XrunDetector::Event* out, int maxEvents) const
+{
+    return xruns_.getRecentEvents(out, maxEvents);
+}
+
+PerformanceMonitor::StageBreakdown PerformanceMonitor::getStageBreakdown() const
+{
+    StageBreakdown breakdown;
+    breakdown.blocks = stageBlocks_.load(std::memory_order_relaxed);
+    if (breakdown.blocks == 0) {
+        return breakdown;
+    }
+
+    const double blockTotalNs = static_cast<double>(stageBlockTotalNs_.load(std::memory_order_relaxed));
+
+    for (int i = 0; i < NUM_STAGES; ++i) {
+        const double totalNs = static_cast<double>(stageTotalNs_[static_cast<size_t>(i)].load(std::memory_order_relaxed));
+        breakdown.avgUsPerBlock[static_cast<size_t>(i)] = totalNs / breakdown.blocks / 1000.0;
+        breakdown.maxUsPerBlock[static_cast<size_t>(i)] =
+            stageMaxNs_[static_cast<size_t>(i)].load(std::memory_order_relaxed) / 1000.0;
+        breakdown.sharePercent[static_cast<size_t>(i)] = blockTotalNs > 0.0 ? totalNs / blockTotalNs * 100.0 : 0.0;
+    }
+
+    return breakdown;
+}
+
+std::string PerformanceMonitor::formatStageBreakdown(const StageBreakdown& breakdown)
+{
+    std::string text;
+    for (int i = 0; i < NUM_STAGES; ++i) {
+        char entry[64];
+        std::snprintf(entry, sizeof(entry), "%s%s %.1fus (%.0f%%)",
+                      i == 0 ? "" : " | ",
+                      getStageName(static_cast<Stage>(i)),
+                      breakdown.avgUsPerBlock[static_cast<size_t>(i)],
+                      breakdown.sharePercent[static_cast<size_t>(i)]);
+        text += entry;
+    }
+    return text;
+}
+
+const char* PerformanceMonitor::getStageName(Stage stage)
+{
+    switch (stage) {
+        case Stage::Transfer:   return "Transfer";
+        case Stage::Parameters: return "Params";
+        case Stage::Render:     return "Render";
+        case Stage::Midi:       return "MIDI";
+        case Stage::Finalize:   return "Finalize";
+        default:                return "?";
+    }
+}
+
 //==============================================================================
 // Private Methods
 
+void PerformanceMonitor::publishStageTimes(int64_t blockNs)
+{
+    // Single writer - load/store instead of RMW
+    for (int i = 0; i < NUM_STAGES; ++i) {
+        const auto stageNs = static_cast<uint64_t>(std::max<int64_t>(0, blockStageNs_[static_cast<size_t>(i)]));
+        auto& total = stageTotalNs_[static_cast<size_t>(i)];
+        auto& maxNs = stageMaxNs_[static_cast<size_t>(i)];
+
+        total.store(total.load(std::memory_order_relaxed) + stageNs, std::memory_order_relaxed);
+        if (stageNs > maxNs.load(std::memory_order_relaxed)) {
+            maxNs.store(stageNs, std::memory_order_relaxed);
+        }
+        blockStageNs_[static_cast<size_t>(i)] = 0;
+    }
+
+    stageBlockTotalNs_.store(stageBlockTotalNs_.load(std::memory_order_relaxed) +
+                             static_cast<uint64_t>(std::max<int64_t>(0, blockNs)),
+                             std::memory_order_relaxed);
+    stageBlocks_.store(stageBlocks_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void PerformanceMonitor::clearStageTotals()
+{
+    for (int i = 0; i < NUM_STAGES; ++i) {
+        stageTotalNs_[static_cast<size_t>(i)].store(0);
+        stageMaxNs_[static_cast<size_t>(i)].store(0);
+    }
+    stageBlocks_.store(0);
+    stageBlockTotalNs_.store(0);
+}
+
 void PerformanceMonitor::updateAvailableTime()
 {
     double sr = sampleRate_.load();
@@ -102,38 +212,31 @@ void PerformanceMonitor::updateAvailableTime()
     }
 }
 
-void PerformanceMonitor::updateStatistics(double processingTimeMs)
+void PerformanceMonitor::updateStatistics(uint32_t processingTimeUs)
 {
-    // Update sliding window (RT-safe write)
-    int index = windowIndex_.load();
-    processingTimes_[index] = processingTimeMs;
-
-    // Advance window index (circular buffer)
-    int nextIndex = (index + 1) % WINDOW_SIZE;
-    windowIndex_.store(nextIndex);
-
-    // Track how many samples we have
-    int filled = windowFilled_.load();
-    if (filled < WINDOW_SIZE) {
-        windowFilled_.store(filled + 1);
+    if (resetRequested_.exchange(false)) {
+        processingTimesUs_.fill(0);
+        windowIndex_ = 0;
+        windowFilled_ = 0;
+        windowSumUs_ = 0;
+        clearStageTotals();
     }
 
-    // Calculate statistics
-    int sampleCount = std::min(filled + 1, WINDOW_SIZE);
-
-    // Average processing time
-    double sum = 0.0;
-    double maxTime = 0.0;
+    // Update sliding window - running sum, O(1) per block
+    windowSumUs_ -= processingTimesUs_[static_cast<size_t>(windowIndex_)];
+    processingTimesUs_[static_cast<size_t>(windowIndex_)] = processingTimeUs;
+    windowSumUs_ += processingTimeUs;
 
-    for (int i = 0; i < sampleCount; ++i) {
-        double time = processingTimes_[i];
-        sum += time;
-        maxTime = std::max(maxTime, time);
+    windowIndex_ = (windowIndex_ + 1) % WINDOW_SIZE;
+    if (windowFilled_ < WINDOW_SIZE) {
+        ++windowFilled_;
     }
 
-    double avgTime = sum / static_cast<double>(sampleCount);
+    histogram_.record(processingTimeUs);
+
+    double avgTime = (static_cast<double>(windowSumUs_) / windowFilled_) / 1000.0;
     avgProcessingTimeMs_.store(avgTime);
-    maxProcessingTimeMs_.store(maxTime);
+    maxProcessingTimeMs_.store(histogram_.getWindowMaxMs());
 
     // CPU usage calculation
     double availableTime = availableTimeMs_.load();
@@ -143,11 +246,6 @@ void PerformanceMonitor::updateStatistics(double processingTimeMs)
         cpuPercent = (avgTime / availableTime) * 100.0;
         cpuUsagePercent_.store(cpuPercent);
 
-        // Dropout detection
-        if (processingTimeMs > availableTime * DROPOUT_THRESHOLD) {
-            dropoutCount_.fetch_add(1);
-        }
-
         // Warning threshold
         if (cpuPercent > (WARNING_THRESHOLD * 100.0)) {
             isDropoutRisk_.store(true);
@@ -3,16 +3,19 @@
  * @brief Real-time audio performance monitoring and dropout detection
  *
  * Thread-safe performance metrics for audio processing monitoring.
- * Tracks processing time, CPU usage, and dropout detection.
+ * Tracks processing time, CPU usage, and dropout/xrun detection.
  */
 
 #pragma once
 
+#include "ithaca/config/IthacaConfig.h"
 #include "ithaca/config/AppConstants.h"
+#include "ithaca/audio/LatencyHistogram.h"
+#include "ithaca/audio/XrunDetector.h"
 #include <atomic>
 #include <chrono>
 #include <array>
-#include <mutex>
+#include <string>
 
 /**
  * @class PerformanceMonitor
@@ -20,22 +23,92 @@
  *
  * Features:
  * - High-resolution timing of processBlock() calls
- * - Sliding window average for CPU usage
+ * - Sliding window average for CPU usage (O(1) per block)
+ * - Log-bucket latency histogram with p50/p95/p99/p99.9 (lock-free)
  * - Dropout detection (processing time > available time)
+ * - Xrun detection from callback timing (late/missed callbacks, XrunDetector)
+ * - Per-stage timing breakdown of processBlock() (ScopedStage probes)
  * - Thread-safe read access for GUI
  * - Minimal overhead in RT thread
  */
 class PerformanceMonitor {
 public:
+    /**
+     * @enum Stage
+     * @brief processBlock() stages measured by ScopedStage probes
+     */
+    enum class Stage {
+        Transfer,       ///< checkAndTransferVoiceManager()
+        Parameters,     ///< updateSamplerParametersRTSafe()
+        Render,         ///< All processBlockSegment() calls (+ release triggers)
+        Midi,           ///< MIDI event handling
+        Finalize,       ///< finalizeBlock() - LFO pan + DSP chain
+        Count
+    };
+
+    static constexpr int NUM_STAGES = static_cast<int>(Stage::Count);
+
+    /**
+     * @struct StageBreakdown
+     * @brief Per-stage averages since last reset
+     */
+    struct StageBreakdown {
+        std::array<double, NUM_STAGES> avgUsPerBlock {};   ///< Average time per block (µs)
+        std::array<double, NUM_STAGES> maxUsPerBlock {};   ///< Worst block (µs)
+        std::array<double, NUM_STAGES> sharePercent {};    ///< Share of total block time
+        uint64_t blocks = 0;
+    };
+
+    /**
+     * @class ScopedStage
+     * @brief RAII probe - adds elapsed time to a stage of the current block
+     *
+     * Nullable monitor, so call sites need no extra checks. Compiles to nothing
+     * with ITHACA_ENABLE_STAGE_PROFILING 0.
+     */
+    class ScopedStage {
+    public:
+        ScopedStage(PerformanceMonitor* monitor, Stage stage)
+#if ITHACA_ENABLE_STAGE_PROFILING
+            : monitor_(monitor), stage_(stage), start_(std::chrono::steady_clock::now())
+#endif
+        {
+#if !ITHACA_ENABLE_STAGE_PROFILING
+            (void)monitor; (void)stage;
+#endif
+        }
+
+        ~ScopedStage()
+        {
+#if ITHACA_ENABLE_STAGE_PROFILING
+            if (monitor_) {
+                monitor_->addStageTime(stage_, std::chrono::steady_clock::now() - start_);
+            }
+#endif
+        }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+
+    private:
+#if ITHACA_ENABLE_STAGE_PROFILING
+        PerformanceMonitor* monitor_;
+        Stage stage_;
+        std::chrono::steady_clock::time_point start_;
+#endif
+    };
+
     /**
      * @struct PerformanceMetrics
      * @brief Thread-safe snapshot of performance data
      */
     struct PerformanceMetrics {
         double avgProcessingTimeMs = 0.0;      ///< Average processing time (ms)
-        double maxProcessingTimeMs = 0.0;      ///< Peak processing time (ms)
+        double maxProcessingTimeMs = 0.0;      ///< Peak processing time in window (ms)
         double cpuUsagePercent = 0.0;          ///< CPU usage percentage
-        int dropoutCount = 0;                  ///< Total dropout count
+        LatencyHistogram::Percentiles latency; ///< Tail latency over the histogram window
+        int dropoutCount = 0;                  ///< Blocks over the engine time budget
+        XrunDetector::Counters xruns;          ///< Late/missed callbacks + budget overruns
         bool isDropoutRisk = false;            ///< Warning flag (>80% CPU)
     };
 
@@ -53,10 +126,16 @@ public:
      */
     void setAudioSettings(double sampleRate, int bufferSize);
 
+    /**
+     * @brief Host render mode - offline render has no callback deadlines (any thread)
+     */
+    void setNonRealtime(bool nonRealtime) { xruns_.setNonRealtime(nonRealtime); }
+
     /**
      * @brief Start timing measurement (call at start of processBlock)
+     * @param numSamples Samples requested by the host in this callback
      */
-    void startMeasurement();
+    void startMeasurement(int numSamples);
 
     /**
      * @brief End timing measurement (call at end of processBlock)
@@ -70,7 +149,48 @@ public:
     PerformanceMetrics getMetrics() const;
 
     /**
-     * @brief Reset all statistics
+     * @brief Latency percentiles (thread-safe, lock-free)
+     * @param scope Rolling window or everything since reset
+     */
+    LatencyHistogram::Percentiles getLatencyPercentiles(LatencyHistogram::Scope scope) const;
+
+    /**
+     * @brief Most recent xrun events, oldest first (thread-safe, lock-free)
+     * @return Number of events copied
+     */
+    int getRecentXruns(XrunDetector::Event* out, int maxEvents) const;
+
+    /**
+     * @brief Per-stage timing breakdown (thread-safe, lock-free)
+     */
+    StageBreakdown getStageBreakdown() const;
+
+    /**
+     * @brief Human-readable one-line breakdown (non-RT, for logs / debug panel)
+     */
+    static std::string formatStageBreakdown(const StageBreakdown& breakdown);
+
+    /**
+     * @brief Stage name for display
+     */
+    static const char* getStageName(Stage stage);
+
+    /**
+     * @brief Add time to a stage of the current block (audio thread, via ScopedStage)
+     */
+    void addStageTime(Stage stage, std::chrono::steady_clock::duration elapsed)
+    {
+        blockStageNs_[static_cast<size_t>(stage)] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    /**
+     * @brief Set histogram window length in blocks
+     */
+    void setHistogramWindowBlocks(int blocks);
+
+    /**
+     * @brief Reset all statistics (any thread, applied by the audio thread)
      */
     void reset();
 
@@ -81,13 +201,28 @@ private:
     std::atomic<double> availableTimeMs_;  ///< Time available per block
 
     // Timing
-    std::chrono::high_resolution_clock::time_point measurementStart_;
+    std::chrono::steady_clock::time_point measurementStart_;
+
+    // Callback timing (late/missed callbacks, budget overruns)
+    XrunDetector xruns_;
 
-    // Statistics (sliding window)
+    // Statistics (sliding window, audio thread only)
     static constexpr int WINDOW_SIZE = Constants::Performance::MONITORING_WINDOW_SIZE;
-    std::array<double, WINDOW_SIZE> processingTimes_;
-    std::atomic<int> windowIndex_;
-    std::atomic<int> windowFilled_;
+    std::array<uint32_t, WINDOW_SIZE> processingTimesUs_;
+    int windowIndex_;
+    int windowFilled_;
+    uint64_t windowSumUs_;
+
+    // Tail latency (lock-free, single writer)
+    LatencyHistogram histogram_;
+    std::atomic<bool> resetRequested_;
+
+    // Stage timing: per-block scratch (audio thread) + published totals (single writer)
+    std::array<int64_t, NUM_STAGES> blockStageNs_ {};
+    std::array<std::atomic<uint64_t>, NUM_STAGES> stageTotalNs_;
+    std::array<std::atomic<uint64_t>, NUM_STAGES> stageMaxNs_;
+    std::atomic<uint64_t> stageBlocks_;
+    std::atomic<uint64_t> stageBlockTotalNs_;
 
     // Metrics (atomic for thread safety)
     std::atomic<double> avgProcessingTimeMs_;
@@ -96,12 +231,8 @@ private:
     std::atomic<int> dropoutCount_;
     std::atomic<bool> isDropoutRisk_;
 
-    // Mutex for window array access (non-RT read only)
-    mutable std::mutex metricsMutex_;
-
     // Thresholds (from AppConstants)
     static constexpr double WARNING_THRESHOLD = Constants::Performance::Thresholds::CPU_WARNING;
-    static constexpr double DROPOUT_THRESHOLD = Constants::Performance::Thresholds::CPU_DROPOUT;
 
     /**
      * @brief Calculate available time per audio block
@@ -109,7 +240,17 @@ private:
     void updateAvailableTime();
 
     /**
-     * @brief Update statistics from sliding window
+     * @brief Update statistics with one measurement (audio thread)
+     */
+    void updateStatistics(uint32_t processingTimeUs);
+
+    /**
+     * @brief Publish this block's stage times and clear the scratch (audio thread)
+     */
+    void publishStageTimes(int64_t blockNs);
+
+    /**
+     * @brief Clear published stage totals
      */
-    void updateStatistics(double processingTimeMs);
+    void clearStageTotals();
 };
@@ -0,0 +1,264 @@
+/**
+ * @file ReleaseTriggerPool.cpp
+ * @brief Implementation of release-trigger sample loading and playback
+ */
+
+#include "ithaca/audio/ReleaseTriggerPool.h"
+#include "ithaca/config/AppConstants.h"
+#include "ithaca-core/sampler/core_logger.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float PCM16_TO_FLOAT = 1.0f / 32768.0f;
+
+    /**
+     * @brief Mix one playback from either storage format (float or int16)
+     * @return false once the playback ran past the end of its sample
+     */
+    template <typename SampleType>
+    bool mixSamples(const SampleType* srcL, const SampleType* srcR, int lastIndex, float scale,
+                    double& position, double increment, float& gain, float gainStep,
+                    float* left, float* right, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i) {
+            const int index = static_cast<int>(position);
+            if (index >= lastIndex) {
+                return false;
+            }
+
+            // Linear interpolation (covers sample rate mismatch), format conversion folded into the gain
+            const float frac = static_cast<float>(position - index);
+            const float l0 = static_cast<float>(srcL[index]);
+            const float r0 = static_cast<float>(srcR[index]);
+            const float voiceScale = gain * scale;
+            left[i]  += voiceScale * (l0 + frac * (static_cast<float>(srcL[index + 1]) - l0));
+            right[i] += voiceScale * (r0 + frac * (static_cast<float>(srcR[index + 1]) - r0));
+
+            position += increment;
+            gain += gainStep;
+        }
+        return true;
+    }
+}
+
+//==============================================================================
+// Loading (non-RT)
+
+int ReleaseTriggerPool::loadFromDirectory(const juce::File& directory,
+                                          int targetSampleRate,
+                                          int voiceCount,
+                                          const std::atomic<bool>& shouldStop,
+                                          Logger& logger)
+{
+    voiceCount_ = std::clamp(voiceCount, 1, ITHACA_MAX_RELEASE_VOICES);
+    loadedSampleCount_ = 0;
+    stealFadeSamples_ = std::max(1, static_cast<int>(
+        targetSampleRate * Constants::Audio::ReleaseTriggers::STEAL_FADE_MS / 1000.0));
+
+    if (!directory.isDirectory()) {
+        logger.log("ReleaseTriggerPool/loadFromDirectory", LogSeverity::Warning,
+                  "Release trigger directory not found: " + directory.getFullPathName().toStdString());
+        return 0;
+    }
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    for (int note = ITHACA_MIDI_NOTE_MIN; note <= ITHACA_MIDI_NOTE_MAX; ++note) {
+        if (shouldStop.load()) {
+            logger.log("ReleaseTriggerPool/loadFromDirectory", LogSeverity::Warning,
+                      "Loading interrupted at note " + std::to_string(note));
+            return loadedSampleCount_;
+        }
+
+        auto file = directory.getChildFile(juce::String(note) + ".wav");
+        if (!file.existsAsFile()) {
+            continue;
+        }
+
+        std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+        if (!reader || reader->lengthInSamples <= 0) {
+            logger.log("ReleaseTriggerPool/loadFromDirectory", LogSeverity::Warning,
+                      "Cannot read release sample: " + file.getFileName().toStdString());
+            continue;
+        }
+
+        auto& sample = samples_[static_cast<size_t>(note)];
+        const int length = static_cast<int>(reader->lengthInSamples);
+        const int channels = reader->numChannels == 1 ? 1 : 2;
+
+        sample.numChannels = channels;
+        sample.length = length;
+        sample.data.setSize(channels, length);
+        reader->read(&sample.data, 0, length, 0, true, channels == 2);
+
+        // 16-bit integer sources round-trip exactly through float - keep them at half the size
+        sample.compact = ITHACA_COMPACT_RELEASE_SAMPLES != 0
+                      && !reader->usesFloatingPointData && reader->bitsPerSample <= 16;
+        if (sample.compact) {
+            sample.pcm16.resize(static_cast<size_t>(channels) * static_cast<size_t>(length));
+            for (int ch = 0; ch < channels; ++ch) {
+                const float* src = sample.data.getReadPointer(ch);
+                int16_t* dst = sample.pcm16.data() + static_cast<size_t>(ch) * static_cast<size_t>(length);
+                for (int i = 0; i < length; ++i) {
+                    dst[i] = static_cast<int16_t>(std::clamp(std::lrint(src[i] * 32768.0f), -32768L, 32767L));
+                }
+            }
+            sample.data.setSize(0, 0);
+        }
+
+        sample.increment = reader->sampleRate / static_cast<double>(targetSampleRate);
+        sample.loaded = true;
+        ++loadedSampleCount_;
+    }
+
+    logger.log("ReleaseTriggerPool/loadFromDirectory", LogSeverity::Info,
+              "Loaded " + std::to_string(loadedSampleCount_) + " release samples, pool size " +
+              std::to_string(voiceCount_) + " voices");
+
+    return loadedSampleCount_;
+}
+
+int64_t ReleaseTriggerPool::getMemoryBytes() const
+{
+    int64_t bytes = 0;
+    for (const auto& sample : samples_) {
+        if (sample.loaded) {
+            bytes += static_cast<int64_t>(sample.numChannels) * sample.length
+                   * static_cast<int64_t>(sample.compact ? sizeof(int16_t) : sizeof(float));
+        }
+    }
+    return bytes;
+}
+
+//==============================================================================
+// Note Events (RT-safe)
+
+void ReleaseTriggerPool::noteOn(uint8_t midiNote, uint8_t velocity)
+{
+    noteVelocity_[midiNote & 0x7F] = velocity;
+}
+
+void ReleaseTriggerPool::trigger(uint8_t midiNote)
+{
+    const auto& sample = samples_[midiNote & 0x7F];
+    if (!sample.loaded || voiceCount_ == 0) {
+        return;
+    }
+
+    Voice* allocated = allocateVoice();
+    if (allocated == nullptr) {
+        return;     // Every voice is mid-crossfade - skipping is quieter than a click
+    }
+    auto& voice = *allocated;
+
+    // Stolen voice: its playback fades out instead of being cut mid-sample
+    if (voice.active && voice.playback.sample) {
+        voice.stolen = voice.playback;
+        voice.stolen.remaining = stealFadeSamples_;
+        voice.stolen.gainStep = -voice.stolen.gain / static_cast<float>(stealFadeSamples_);
+    }
+
+    voice.playback = Playback();
+    voice.playback.sample = &sample;
+    voice.playback.gain = noteVelocity_[midiNote & 0x7F] / 127.0f;
+    voice.startOrder = ++triggerCounter_;
+    voice.active = true;
+}
+
+void ReleaseTriggerPool::stopAll()
+{
+    for (auto& voice : voices_) {
+        voice.playback.sample = nullptr;
+        voice.stolen.sample = nullptr;
+        voice.active = false;
+    }
+}
+
+//==============================================================================
+// Rendering (RT-safe)
+
+void ReleaseTriggerPool::renderSegment(float* left, float* right, int numSamples)
+{
+    for (int v = 0; v < voiceCount_; ++v) {
+        auto& voice = voices_[static_cast<size_t>(v)];
+        if (!voice.active) {
+            continue;
+        }
+
+        if (voice.stolen.sample && !mixPlayback(voice.stolen, left, right, numSamples)) {
+            voice.stolen.sample = nullptr;
+        }
+        if (voice.playback.sample && !mixPlayback(voice.playback, left, right, numSamples)) {
+            voice.playback.sample = nullptr;
+        }
+        voice.active = voice.playback.sample != nullptr || voice.stolen.sample != nullptr;
+    }
+}
+
+bool ReleaseTriggerPool::mixPlayback(Playback& playback, float* left, float* right, int numSamples)
+{
+    const auto& sample = *playback.sample;
+    const int lastIndex = sample.length - 1;
+    const int rightChannel = sample.numChannels > 1 ? 1 : 0;    // Mono plays on both sides
+
+    // Fade-out ends inside this segment - mix only its remaining samples
+    const int count = playback.remaining >= 0 ? std::min(numSamples, playback.remaining) : numSamples;
+
+    bool playing;
+    if (sample.compact) {
+        const int16_t* srcL = sample.pcm16.data();
+        const int16_t* srcR = srcL + static_cast<size_t>(rightChannel) * static_cast<size_t>(sample.length);
+        playing = mixSamples(srcL, srcR, lastIndex, PCM16_TO_FLOAT, playback.position, sample.increment,
+                             playback.gain, playback.gainStep, left, right, count);
+    } else {
+        playing = mixSamples(sample.data.getReadPointer(0), sample.data.getReadPointer(rightChannel),
+                             lastIndex, 1.0f, playback.position, sample.increment,
+                             playback.gain, playback.gainStep, left, right, count);
+    }
+
+    if (playback.remaining >= 0) {
+        playback.remaining -= count;
+        playing = playing && playback.remaining > 0;
+    }
+    return playing;
+}
+
+int ReleaseTriggerPool::getActiveVoiceCount() const
+{
+    int count = 0;
+    for (int v = 0; v < voiceCount_; ++v) {
+        if (voices_[static_cast<size_t>(v)].active) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+//==============================================================================
+// Private Helpers
+
+ReleaseTriggerPool::Voice* ReleaseTriggerPool::allocateVoice()
+{
+    Voice* oldest = nullptr;
+
+    for (int v = 0; v < voiceCount_; ++v) {
+        auto& voice = voices_[static_cast<size_t>(v)];
+        if (!voice.active) {
+            return &voice;
+        }
+        // A voice whose stolen slot is still fading cannot take another steal:
+        // overwriting that fade would cut it mid-sample
+        if (voice.stolen.sample != nullptr) {
+            continue;
+        }
+        if (oldest == nullptr || voice.startOrder < oldest->startOrder) {
+            oldest = &voice;
+        }
+    }
+
+    // Pool full - steal the oldest release voice (main voices are never touched)
+    return oldest;
+}
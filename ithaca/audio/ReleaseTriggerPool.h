@@ -0,0 +1,150 @@
+/**
+ * @file ReleaseTriggerPool.h
+ * @brief Release-trigger (key-up noise) samples with a dedicated voice pool
+ *
+ * Release samples are declared in instrument-definition.json ("releaseTriggers")
+ * and loaded by AsyncSampleLoader in the same pass as the main sample bank.
+ * Playback uses a fixed, preallocated pool that is independent of the
+ * IthacaCore VoiceManager, so release triggers never steal main voices.
+ */
+
+#pragma once
+
+#include "ithaca/config/IthacaConfig.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Forward declarations
+class Logger;
+
+/**
+ * @class ReleaseTriggerPool
+ * @brief Owns release-trigger sample data and renders release voices
+ *
+ * Features:
+ * - One optional stereo sample per MIDI note (<MIDI_note>.wav)
+ * - Fixed voice pool (size from metadata), oldest release voice is stolen
+ *   (its playback fades out over STEAL_FADE_MS while the new one starts;
+ *   a voice still fading is never stolen again, the trigger is dropped instead)
+ * - Playback gain follows the velocity of the preceding Note On
+ * - Sample rate mismatch handled by linear interpolation at playback
+ * - Compact storage: 16-bit sources kept as int16, mono kept as one channel
+ *
+ * Thread Safety:
+ * - loadFromDirectory() runs on the loader thread before ownership transfer
+ * - All other methods are audio-thread only (RT-safe, no allocation)
+ */
+class ReleaseTriggerPool {
+public:
+    ReleaseTriggerPool() = default;
+
+    //==========================================================================
+    // Loading (non-RT)
+
+    /**
+     * @brief Load release samples and preallocate the voice pool
+     * @param directory Directory with <MIDI_note>.wav files
+     * @param targetSampleRate Engine sample rate
+     * @param voiceCount Pool size (clamped to 1..ITHACA_MAX_RELEASE_VOICES)
+     * @param shouldStop Loader interrupt flag, checked between files
+     * @param logger Logger for progress and errors
+     * @return Number of loaded samples (0 = nothing to play)
+     */
+    int loadFromDirectory(const juce::File& directory,
+                          int targetSampleRate,
+                          int voiceCount,
+                          const std::atomic<bool>& shouldStop,
+                          Logger& logger);
+
+    //==========================================================================
+    // Note Events (RT-safe)
+
+    /**
+     * @brief Remember Note On velocity for the matching release trigger
+     */
+    void noteOn(uint8_t midiNote, uint8_t velocity);
+
+    /**
+     * @brief Start a release voice for the note (no-op without a sample)
+     */
+    void trigger(uint8_t midiNote);
+
+    /**
+     * @brief Silence all release voices immediately
+     */
+    void stopAll();
+
+    //==========================================================================
+    // Rendering (RT-safe)
+
+    /**
+     * @brief Mix active release voices into the output segment (additive)
+     * @param left Left channel pointer (segment start)
+     * @param right Right channel pointer (segment start)
+     * @param numSamples Segment length
+     */
+    void renderSegment(float* left, float* right, int numSamples);
+
+    //==========================================================================
+    // State Queries
+
+    bool hasSamples() const { return loadedSampleCount_ > 0; }
+    int getLoadedSampleCount() const { return loadedSampleCount_; }
+    int getVoiceCount() const { return voiceCount_; }
+    int getActiveVoiceCount() const;
+
+    /**
+     * @brief Memory held by decoded release samples (bytes)
+     */
+    int64_t getMemoryBytes() const;
+
+private:
+    struct Sample {
+        juce::AudioBuffer<float> data;  ///< Float storage (>16-bit or float sources)
+        std::vector<int16_t> pcm16;     ///< Compact storage, channels back to back
+        int numChannels = 0;            ///< 1 (mono, played on both sides) or 2
+        int length = 0;                 ///< Frames per channel
+        double increment = 1.0;         ///< Source samples per output sample
+        bool compact = false;           ///< true = pcm16, false = data
+        bool loaded = false;
+    };
+
+    struct Playback {
+        const Sample* sample = nullptr; ///< nullptr = nothing to play
+        double position = 0.0;
+        float gain = 0.0f;
+        float gainStep = 0.0f;          ///< Per-sample gain change (negative = fade-out)
+        int remaining = -1;             ///< Samples left of a fade-out, -1 = to the end
+    };
+
+    struct Voice {
+        Playback playback;
+        Playback stolen;                ///< Previous playback fading out after a steal
+        uint32_t startOrder = 0;        ///< For oldest-voice stealing
+        bool active = false;
+    };
+
+    std::array<Sample, 128> samples_;
+    std::array<Voice, ITHACA_MAX_RELEASE_VOICES> voices_;
+    std::array<uint8_t, 128> noteVelocity_ {};
+
+    int voiceCount_ = 0;
+    int loadedSampleCount_ = 0;
+    int stealFadeSamples_ = 1;
+    uint32_t triggerCounter_ = 0;
+
+    /**
+     * @brief Free voice, or the oldest one with no fade pending when the pool is full
+     * @return nullptr when every voice is still fading out a previous steal
+     */
+    Voice* allocateVoice();
+
+    /**
+     * @brief Mix a playback into the segment (either storage format)
+     * @return false once the playback ended (sample end or fade-out done)
+     */
+    static bool mixPlayback(Playback& playback, float* left, float* right, int numSamples);
+};
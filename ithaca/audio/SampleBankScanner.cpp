@@ -0,0 +1,133 @@
+/**
+ * @file SampleBankScanner.cpp
+ * @brief Implementation of sample bank directory scan
+ */
+
+#include "ithaca/audio/SampleBankScanner.h"
+#include "ithaca/config/IthacaConfig.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace {
+
+/**
+ * @brief FNV-1a hash of one directory entry (relative path, size, modification time)
+ */
+uint64_t hashEntry(const std::string& relativePath, int64_t size, int64_t modified)
+{
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    auto hashBytes = [](uint64_t hash, const void* data, size_t count) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < count; ++i) {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+        return hash;
+    };
+
+    uint64_t hash = hashBytes(FNV_OFFSET, relativePath.data(), relativePath.size());
+    hash = hashBytes(hash, &size, sizeof(size));
+    return hashBytes(hash, &modified, sizeof(modified));
+}
+
+} // namespace
+
+//==============================================================================
+// Public Interface
+
+SampleBankFootprint SampleBankScanner::scan(const juce::File& directory,
+                                            int targetSampleRate,
+                                            const std::atomic<bool>& shouldStop)
+{
+    SampleBankFootprint footprint;
+    if (!directory.isDirectory()) {
+        return footprint;
+    }
+
+    // Single recursive listing: every file feeds the fingerprint,
+    // top-level <note>_<layer>.wav files make up the bank.
+    // Sum of per-file hashes - independent of directory iteration order
+    for (const auto& entry : juce::RangedDirectoryIterator(directory, true, "*", juce::File::findFiles)) {
+        if (shouldStop.load()) {
+            break;
+        }
+
+        const auto file = entry.getFile();
+        const int64_t fileBytes = entry.getFileSize();
+        footprint.fingerprint += hashEntry(file.getRelativePathFrom(directory).toStdString(),
+                                           fileBytes, entry.getModificationTime().toMilliseconds());
+
+        SampleFileInfo info;
+        if (file.getParentDirectory() != directory || !file.hasFileExtension("wav") ||
+            !parseFileName(file.getFileName(), info.midiNote, info.velocityLayer)) {
+            continue;
+        }
+
+        info.file = file;
+        info.fileBytes = fileBytes;
+        footprint.totalFileBytes += fileBytes;
+        footprint.files.push_back(std::move(info));
+    }
+
+    std::sort(footprint.files.begin(), footprint.files.end(),
+              [](const SampleFileInfo& a, const SampleFileInfo& b) {
+                  return a.midiNote != b.midiNote ? a.midiNote < b.midiNote : a.velocityLayer < b.velocityLayer;
+              });
+
+    // Decoded/disk ratio from the first readable header, applied to every file
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    double residentPerFileByte = 0.0;
+    for (const auto& info : footprint.files) {
+        if (shouldStop.load()) {
+            break;
+        }
+        // Header only - the reader does not decode until read() is called
+        std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(info.file));
+        if (reader && info.fileBytes > 0) {
+            residentPerFileByte = static_cast<double>(
+                estimateResidentBytes(reader->lengthInSamples, reader->sampleRate, targetSampleRate)) /
+                static_cast<double>(info.fileBytes);
+            break;
+        }
+    }
+
+    for (auto& info : footprint.files) {
+        info.residentBytes = static_cast<int64_t>(static_cast<double>(info.fileBytes) * residentPerFileByte);
+        footprint.totalResidentBytes += info.residentBytes;
+    }
+
+    return footprint;
+}
+
+bool SampleBankScanner::parseFileName(const juce::String& fileName, int& midiNote, int& velocityLayer)
+{
+    const auto baseName = fileName.upToLastOccurrenceOf(".", false, false);
+    const int separator = baseName.indexOfChar('_');
+    if (separator <= 0) {
+        return false;
+    }
+
+    const auto notePart = baseName.substring(0, separator);
+    const auto layerPart = baseName.substring(separator + 1);
+    if (!notePart.containsOnly("0123456789") || !layerPart.containsOnly("0123456789") || layerPart.isEmpty()) {
+        return false;
+    }
+
+    midiNote = notePart.getIntValue();
+    velocityLayer = layerPart.getIntValue();
+    return midiNote >= ITHACA_MIDI_NOTE_MIN && midiNote <= ITHACA_MIDI_NOTE_MAX && velocityLayer >= 1;
+}
+
+int64_t SampleBankScanner::estimateResidentBytes(int64_t lengthInSamples, double fileSampleRate, int targetSampleRate)
+{
+    if (lengthInSamples <= 0 || fileSampleRate <= 0.0 || targetSampleRate <= 0) {
+        return 0;
+    }
+
+    const double frames = std::ceil(static_cast<double>(lengthInSamples) * targetSampleRate / fileSampleRate);
+    return static_cast<int64_t>(frames) * 2 * static_cast<int64_t>(sizeof(float));
+}
@@ -0,0 +1,75 @@
+/**
+ * @file SampleBankScanner.h
+ * @brief Sample bank directory scan - file list, content fingerprint, footprint estimate
+ *
+ * IthacaCore decodes the bank inside VoiceManager::loadSampleBank(), so the
+ * plugin cannot observe individual files there. The scanner lists the
+ * directory once up front (no decoding, a single WAV header read) to give the
+ * loader the content fingerprint, totals for progress and a resident-size
+ * estimate for the metrics.
+ */
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct SampleFileInfo
+ * @brief One <MIDI_note>_<velocity_layer>.wav file of a bank
+ */
+struct SampleFileInfo {
+    juce::File file;
+    int midiNote = 0;
+    int velocityLayer = 0;
+    int64_t fileBytes = 0;          ///< Size on disk
+    int64_t residentBytes = 0;      ///< Estimated decoded size at target rate (see scan())
+};
+
+/**
+ * @struct SampleBankFootprint
+ * @brief Scan result
+ */
+struct SampleBankFootprint {
+    std::vector<SampleFileInfo> files;
+    int64_t totalFileBytes = 0;
+    int64_t totalResidentBytes = 0;
+    uint64_t fingerprint = 0;       ///< Content fingerprint of the whole directory (0 = none)
+};
+
+/**
+ * @class SampleBankScanner
+ * @brief Static helpers for bank directory inspection (loader thread)
+ */
+class SampleBankScanner {
+public:
+    /**
+     * @brief Scan bank directory - one listing pass, no decoding
+     * @param directory Bank directory (release/ subdirectory included in the fingerprint)
+     * @param targetSampleRate Engine sample rate (for resampled size estimate)
+     * @param shouldStop Loader interrupt flag, checked per file
+     * @return Files sorted by note and layer, with totals and fingerprint
+     *
+     * The fingerprint is an order-independent hash of relative paths, sizes and
+     * modification times of all files; it changes when a file is added,
+     * removed, replaced or touched. Resident size is extrapolated from file
+     * sizes with the decoded/disk ratio of one representative header, since a
+     * bank is recorded in a single format.
+     */
+    static SampleBankFootprint scan(const juce::File& directory,
+                                    int targetSampleRate,
+                                    const std::atomic<bool>& shouldStop);
+
+    /**
+     * @brief Parse "<note>_<layer>.wav"
+     * @return true if the name matches the bank naming convention
+     */
+    static bool parseFileName(const juce::String& fileName, int& midiNote, int& velocityLayer);
+
+    /**
+     * @brief Decoded size of a sample: stereo float32 at the target rate
+     */
+    static int64_t estimateResidentBytes(int64_t lengthInSamples, double fileSampleRate, int targetSampleRate);
+};
@@ -0,0 +1,67 @@
+/**
+ * @file SharedEnvelopeData.cpp
+ * @brief Implementation of the shared envelope table lifecycle
+ */
+
+#include "ithaca/audio/SharedEnvelopeData.h"
+#include "ithaca-core/sampler/envelopes/envelope_static_data.h"
+#include <mutex>
+
+namespace {
+    std::mutex& lifecycleMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    int referenceCount = 0;    ///< Guarded by lifecycleMutex()
+
+    bool initializeLocked(Logger& logger)
+    {
+        if (EnvelopeStaticData::isInitialized()) {
+            return true;
+        }
+
+        logger.log("SharedEnvelopeData/initialize", LogSeverity::Info, "Initializing envelope static data...");
+        const bool ok = EnvelopeStaticData::initialize(logger);
+        logger.log("SharedEnvelopeData/initialize", ok ? LogSeverity::Info : LogSeverity::Error,
+                   ok ? "Envelope static data initialized" : "Envelope static data initialization failed");
+        return ok;
+    }
+}
+
+//==============================================================================
+// Lifecycle
+
+bool SharedEnvelopeData::acquire(Logger& logger)
+{
+    std::lock_guard<std::mutex> lock(lifecycleMutex());
+    ++referenceCount;
+    return initializeLocked(logger);
+}
+
+bool SharedEnvelopeData::release()
+{
+    std::lock_guard<std::mutex> lock(lifecycleMutex());
+    if (referenceCount > 0) {
+        --referenceCount;
+    }
+    if (referenceCount > 0 || !EnvelopeStaticData::isInitialized()) {
+        return false;
+    }
+
+    EnvelopeStaticData::cleanup();
+    return true;
+}
+
+bool SharedEnvelopeData::ensureInitialized(Logger& logger)
+{
+    std::lock_guard<std::mutex> lock(lifecycleMutex());
+    return initializeLocked(logger);
+}
+
+int SharedEnvelopeData::getReferenceCount()
+{
+    std::lock_guard<std::mutex> lock(lifecycleMutex());
+    return referenceCount;
+}
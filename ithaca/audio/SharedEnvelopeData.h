@@ -0,0 +1,54 @@
+/**
+ * @file SharedEnvelopeData.h
+ * @brief Reference-counted lifecycle of the process-wide envelope tables
+ *
+ * EnvelopeStaticData (IthacaCore) is global state shared by every plugin
+ * instance in the host process. Each instance used to initialize it lazily
+ * from its loader thread and clean it up in its destructor, so closing one
+ * instance freed the tables under another that was still playing, and two
+ * loaders could initialize them concurrently. Every instance now holds one
+ * reference: the first reference builds the tables, the last one frees them,
+ * and all transitions are serialized.
+ */
+
+#pragma once
+
+#include "ithaca-core/sampler/core_logger.h"
+
+/**
+ * @class SharedEnvelopeData
+ * @brief Static, thread-safe owner of EnvelopeStaticData
+ *
+ * Features:
+ * - acquire()/release() pair per plugin instance (constructor/destructor)
+ * - ensureInitialized() for loader threads - never initializes twice
+ * - Audio thread never touches the lock (tables outlive every VoiceManager)
+ */
+class SharedEnvelopeData {
+public:
+    /**
+     * @brief Take a reference and build the tables if this is the first one (non-RT)
+     * @return true if the tables are available
+     */
+    static bool acquire(Logger& logger);
+
+    /**
+     * @brief Drop a reference and free the tables if it was the last one (non-RT)
+     * @return true if the tables were freed
+     */
+    static bool release();
+
+    /**
+     * @brief Build the tables if missing, serialized with acquire/release (non-RT)
+     * @return true if the tables are available
+     */
+    static bool ensureInitialized(Logger& logger);
+
+    /**
+     * @brief Number of plugin instances holding a reference
+     */
+    static int getReferenceCount();
+
+private:
+    SharedEnvelopeData() = delete;
+};
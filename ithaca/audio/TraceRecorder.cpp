@@ -0,0 +1,229 @@
+/**
+ * @file TraceRecorder.cpp
+ * @brief Implementation of timeline tracing and Chrome Trace Event export
+ */
+
+#include "ithaca/audio/TraceRecorder.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+
+//==============================================================================
+// Instance / Control
+
+TraceRecorder& TraceRecorder::instance()
+{
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder()
+    : epoch_(std::chrono::steady_clock::now())
+{
+}
+
+void TraceRecorder::setEnabled(bool enabled)
+{
+    if (enabled && buffers_.load(std::memory_order_acquire) == nullptr) {
+        // One-time allocation, never on the audio thread (control API only)
+        static std::mutex allocationMutex;
+        std::lock_guard<std::mutex> lock(allocationMutex);
+        if (buffers_.load(std::memory_order_acquire) == nullptr) {
+            buffers_.store(new ThreadBuffer[MAX_THREADS], std::memory_order_release);
+        }
+    }
+
+    enabled_.store(enabled, std::memory_order_release);
+}
+
+void TraceRecorder::clear()
+{
+    auto* buffers = buffers_.load(std::memory_order_acquire);
+    if (!buffers) {
+        return;
+    }
+
+    const int used = std::min(usedBuffers_.load(), MAX_THREADS);
+    for (int i = 0; i < used; ++i) {
+        buffers[i].writeIndex.store(0, std::memory_order_release);
+    }
+}
+
+int64_t TraceRecorder::nowNs() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch_).count();
+}
+
+//==============================================================================
+// Recording (RT-safe)
+
+TraceRecorder::ThreadLease::~ThreadLease()
+{
+    // Thread exits - buffer goes back to the pool, its events stay for the dump
+    if (buffer) {
+        buffer->claimed.store(false, std::memory_order_release);
+    }
+}
+
+template <typename Filter>
+TraceRecorder::ThreadBuffer* TraceRecorder::claimSlot(ThreadBuffer* buffers, Filter&& accept)
+{
+    for (int slot = 0; slot < MAX_THREADS; ++slot) {
+        auto& buffer = buffers[slot];
+        if (buffer.claimed.load(std::memory_order_relaxed) || !accept(buffer)) {
+            continue;
+        }
+
+        bool expected = false;
+        if (buffer.claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            int used = usedBuffers_.load(std::memory_order_relaxed);
+            while (used < slot + 1 &&
+                   !usedBuffers_.compare_exchange_weak(used, slot + 1, std::memory_order_relaxed)) {
+            }
+            return &buffer;
+        }
+    }
+    return nullptr;
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::currentBuffer(const char* name)
+{
+    thread_local ThreadLease lease;
+    if (lease.buffer) {
+        return lease.buffer;
+    }
+
+    auto* buffers = buffers_.load(std::memory_order_acquire);
+    if (!buffers) {
+        return nullptr;
+    }
+
+    // 1. Track of an exited thread with the same role (e.g. the previous loader)
+    if (name) {
+        lease.buffer = claimSlot(buffers, [name](const ThreadBuffer& buffer) {
+            const char* slotName = buffer.name.load(std::memory_order_acquire);
+            return slotName && std::strcmp(slotName, name) == 0;
+        });
+    }
+
+    // 2. Unused slot
+    if (!lease.buffer) {
+        lease.buffer = claimSlot(buffers, [](const ThreadBuffer& buffer) {
+            return buffer.name.load(std::memory_order_acquire) == nullptr &&
+                   buffer.writeIndex.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    // 3. Any free slot - the track keeps earlier events, the new thread renames it
+    if (!lease.buffer) {
+        lease.buffer = claimSlot(buffers, [](const ThreadBuffer&) { return true; });
+        if (lease.buffer) {
+            lease.buffer->name.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    return lease.buffer;  // nullptr: MAX_THREADS live threads already traced
+}
+
+void TraceRecorder::setThreadName(const char* name)
+{
+    if (auto* buffer = currentBuffer(name)) {
+        if (buffer->name.load(std::memory_order_relaxed) == nullptr) {
+            buffer->name.store(name, std::memory_order_release);
+        }
+    }
+}
+
+void TraceRecorder::recordComplete(const char* name, int64_t startNs, int64_t durationNs)
+{
+    push({ name, startNs, std::max<int64_t>(0, durationNs) });
+}
+
+void TraceRecorder::recordInstant(const char* name)
+{
+    push({ name, nowNs(), -1 });
+}
+
+void TraceRecorder::push(const Event& event)
+{
+    auto* buffer = currentBuffer();
+    if (!buffer) {
+        return;
+    }
+
+    // Single producer: write the slot, then publish the new index
+    const uint64_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+    buffer->events[index & (CAPACITY - 1)] = event;
+    buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+//==============================================================================
+// Export (non-RT)
+
+namespace {
+
+    void writeJsonString(std::ostream& out, const char* text)
+    {
+        out << '"';
+        for (const char* c = text; c && *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out << '\\';
+            }
+            out << *c;
+        }
+        out << '"';
+    }
+
+} // namespace
+
+bool TraceRecorder::dumpToFile(const std::string& filePath) const
+{
+    std::ofstream out(filePath);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out << std::fixed << std::setprecision(3);  // µs with ns resolution
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+
+    auto* buffers = buffers_.load(std::memory_order_acquire);
+    const int used = buffers ? std::min(usedBuffers_.load(), MAX_THREADS) : 0;
+
+    for (int i = 0; i < used; ++i) {
+        const auto& buffer = buffers[i];
+        const uint64_t written = buffer.writeIndex.load(std::memory_order_acquire);
+        const uint64_t begin = written > CAPACITY ? written - CAPACITY : 0;
+        const int tid = i + 1;
+
+        // Track name (metadata event)
+        if (const char* name = buffer.name.load(std::memory_order_acquire)) {
+            out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << tid
+                << ",\"args\":{\"name\":";
+            writeJsonString(out, name);
+            out << "}}";
+            first = false;
+        }
+
+        for (uint64_t e = begin; e < written; ++e) {
+            const auto& event = buffer.events[e & (CAPACITY - 1)];
+            out << (first ? "" : ",") << "\n{\"name\":";
+            writeJsonString(out, event.name);
+
+            // Chrome trace timestamps are microseconds (fractional allowed)
+            out << ",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << (event.startNs / 1000.0);
+            if (event.durationNs >= 0) {
+                out << ",\"ph\":\"X\",\"dur\":" << (event.durationNs / 1000.0) << "}";
+            } else {
+                out << ",\"ph\":\"i\",\"s\":\"t\"}";
+            }
+            first = false;
+        }
+    }
+
+    out << "\n]}\n";
+    return out.good();
+}
@@ -0,0 +1,186 @@
+/**
+ * @file TraceRecorder.h
+ * @brief Opt-in timeline tracing with Chrome Trace Event JSON export
+ *
+ * Records what the audio thread, AsyncSampleLoader worker and GUI timers were
+ * doing, so xruns can be correlated with loads and state changes. The dump
+ * loads directly into Perfetto (ui.perfetto.dev) or chrome://tracing.
+ *
+ * Usage:
+ *   ITHACA_TRACE_THREAD("Audio");                 // name the calling thread once
+ *   ITHACA_TRACE_SCOPE("processBlock");            // complete event for the scope
+ *
+ * Compiled out entirely with ITHACA_ENABLE_TRACING 0. When compiled in but
+ * disabled, each probe costs one relaxed atomic load.
+ */
+
+#pragma once
+
+#include "ithaca/config/IthacaConfig.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class TraceRecorder
+ * @brief Process-wide trace recorder with per-thread lock-free ring buffers
+ *
+ * Design:
+ * - Buffers are allocated once, on the first setEnabled(true) (non-RT);
+ *   nothing is allocated while tracing was never enabled
+ * - Fixed pool of thread buffers, claimed with a bounded compare-exchange scan
+ *   on a thread's first event (no locks, no allocation on the audio thread)
+ *   and returned when the thread exits - short-lived loader threads recycle
+ *   slots instead of exhausting the pool
+ * - Each buffer is single-producer; it keeps the newest CAPACITY events
+ * - Event names must be string literals (only the pointer is stored)
+ * - dumpToFile() is non-RT; call it after disabling for an exact snapshot
+ */
+class TraceRecorder {
+public:
+    static constexpr int MAX_THREADS = 16;
+    static constexpr int CAPACITY = 1 << 14;    ///< Events per thread (power of two)
+
+    /**
+     * @brief Process-wide instance
+     */
+    static TraceRecorder& instance();
+
+    //==========================================================================
+    // Control (any thread)
+
+    /**
+     * @brief Enable/disable recording (first enable allocates the buffers)
+     */
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Discard all recorded events (threads keep their buffers)
+     */
+    void clear();
+
+    /**
+     * @brief Write recorded events as Chrome Trace Event JSON
+     * @param filePath Output path
+     * @return true on success
+     */
+    bool dumpToFile(const std::string& filePath) const;
+
+    //==========================================================================
+    // Recording (RT-safe)
+
+    /**
+     * @brief Name the calling thread (string literal), shown as track name
+     */
+    void setThreadName(const char* name);
+
+    /**
+     * @brief Record a complete event [startNs, startNs + durationNs)
+     */
+    void recordComplete(const char* name, int64_t startNs, int64_t durationNs);
+
+    /**
+     * @brief Record an instant event (e.g. VoiceManager swap)
+     */
+    void recordInstant(const char* name);
+
+    /**
+     * @brief Nanoseconds since recorder creation (steady clock)
+     */
+    int64_t nowNs() const;
+
+    /**
+     * @class Scope
+     * @brief RAII complete-event probe
+     */
+    class Scope {
+    public:
+        explicit Scope(const char* name)
+            : name_(name),
+              startNs_(TraceRecorder::instance().isEnabled() ? TraceRecorder::instance().nowNs() : -1)
+        {
+        }
+
+        ~Scope()
+        {
+            if (startNs_ >= 0) {
+                auto& recorder = TraceRecorder::instance();
+                recorder.recordComplete(name_, startNs_, recorder.nowNs() - startNs_);
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* name_;
+        int64_t startNs_;
+    };
+
+private:
+    TraceRecorder();
+
+    struct Event {
+        const char* name = nullptr;
+        int64_t startNs = 0;
+        int64_t durationNs = -1;    ///< -1 = instant event
+    };
+
+    struct ThreadBuffer {
+        std::array<Event, CAPACITY> events;
+        std::atomic<uint64_t> writeIndex { 0 };
+        std::atomic<const char*> name { nullptr };
+        std::atomic<bool> claimed { false };    ///< Owned by a live thread
+    };
+
+    /**
+     * @brief thread_local owner of a claimed buffer, returns it on thread exit
+     */
+    struct ThreadLease {
+        ThreadBuffer* buffer = nullptr;
+        ~ThreadLease();
+    };
+
+    std::atomic<ThreadBuffer*> buffers_ { nullptr };    ///< MAX_THREADS buffers, never freed
+    std::atomic<int> usedBuffers_ { 0 };                ///< High-water mark of claimed slots
+    std::atomic<bool> enabled_ { false };
+    std::chrono::steady_clock::time_point epoch_;
+
+    /**
+     * @brief Buffer of the calling thread (claims a free one on first use,
+     *        nullptr if MAX_THREADS threads are alive and tracing)
+     * @param name Thread name if known - a free slot of the same name is preferred,
+     *             so a new loader thread continues the previous loader's track
+     */
+    ThreadBuffer* currentBuffer(const char* name = nullptr);
+
+    /**
+     * @brief Try to claim a free slot accepted by the filter (lock-free)
+     */
+    template <typename Filter>
+    ThreadBuffer* claimSlot(ThreadBuffer* buffers, Filter&& accept);
+
+    void push(const Event& event);
+};
+
+//==============================================================================
+// Probe macros
+
+#define ITHACA_TRACE_CONCAT_INNER(a, b) a##b
+#define ITHACA_TRACE_CONCAT(a, b) ITHACA_TRACE_CONCAT_INNER(a, b)
+
+#if ITHACA_ENABLE_TRACING
+    #define ITHACA_TRACE_SCOPE(name) \
+        TraceRecorder::Scope ITHACA_TRACE_CONCAT(ithacaTraceScope_, __LINE__)(name)
+    #define ITHACA_TRACE_INSTANT(name) \
+        do { if (TraceRecorder::instance().isEnabled()) TraceRecorder::instance().recordInstant(name); } while (0)
+    #define ITHACA_TRACE_THREAD(name) \
+        do { if (TraceRecorder::instance().isEnabled()) TraceRecorder::instance().setThreadName(name); } while (0)
+#else
+    #define ITHACA_TRACE_SCOPE(name) ((void)0)
+    #define ITHACA_TRACE_INSTANT(name) ((void)0)
+    #define ITHACA_TRACE_THREAD(name) ((void)0)
+#endif
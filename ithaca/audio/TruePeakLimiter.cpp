@@ -0,0 +1,196 @@
+/**
+ * @file TruePeakLimiter.cpp
+ * @brief Implementation of the look-ahead true-peak limiter
+ */
+
+#include "ithaca/audio/TruePeakLimiter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+    constexpr double CEILING_DB = Constants::Audio::TruePeak::CEILING_DB;
+    constexpr double LOOKAHEAD_MS = Constants::Audio::TruePeak::LOOKAHEAD_MS;
+    constexpr double RELEASE_MS = Constants::Audio::TruePeak::RELEASE_MS;
+    constexpr double PASSBAND = 0.9;    ///< Detector cutoff relative to base-rate Nyquist
+}
+
+//==============================================================================
+// Constructor / Preparation
+
+TruePeakLimiter::TruePeakLimiter()
+    : ceiling_(static_cast<float>(std::pow(10.0, CEILING_DB / 20.0)))
+{
+    prepare(48000.0);
+}
+
+void TruePeakLimiter::prepare(double sampleRate)
+{
+    const double rate = sampleRate > 0.0 ? sampleRate : 48000.0;
+
+    // Windowed-sinc lowpass at the oversampled rate, split into polyphase branches
+    const int numTaps = OVERSAMPLING * TAPS_PER_PHASE;
+    const double cutoff = PASSBAND * 0.5 / OVERSAMPLING;    // cycles per oversampled sample
+    const double centre = (numTaps - 1) / 2.0;
+
+    std::vector<double> prototype(static_cast<size_t>(numTaps));
+    for (int k = 0; k < numTaps; ++k) {
+        const double t = k - centre;
+        const double sinc = t == 0.0 ? 2.0 * cutoff : std::sin(2.0 * PI * cutoff * t) / (PI * t);
+        const double window = 0.42 - 0.5 * std::cos(2.0 * PI * k / (numTaps - 1))
+                                   + 0.08 * std::cos(4.0 * PI * k / (numTaps - 1));    // Blackman
+        prototype[static_cast<size_t>(k)] = sinc * window;
+    }
+
+    phaseCoefficients_.assign(static_cast<size_t>(numTaps), 0.0f);
+    for (int phase = 0; phase < OVERSAMPLING; ++phase) {
+        // Unity DC gain per branch (interpolation, not zero-stuffing gain)
+        double branchSum = 0.0;
+        for (int j = 0; j < TAPS_PER_PHASE; ++j) {
+            branchSum += prototype[static_cast<size_t>(phase + j * OVERSAMPLING)];
+        }
+        for (int j = 0; j < TAPS_PER_PHASE; ++j) {
+            phaseCoefficients_[static_cast<size_t>(j * OVERSAMPLING + phase)] =
+                static_cast<float>(prototype[static_cast<size_t>(phase + j * OVERSAMPLING)] / branchSum);
+        }
+    }
+
+    detectorDelay_ = TAPS_PER_PHASE / 2;
+    lookAheadSamples_ = std::max(1, static_cast<int>(std::lround(LOOKAHEAD_MS * rate / 1000.0)));
+    releaseCoeff_ = static_cast<float>(1.0 - std::exp(-1.0 / (RELEASE_MS * rate / 1000.0)));
+
+    const size_t window = static_cast<size_t>(lookAheadSamples_ + 1);
+    const size_t delay = static_cast<size_t>(getLatencySamples());
+
+    historyLeft_.assign(static_cast<size_t>(2 * TAPS_PER_PHASE), 0.0f);
+    historyRight_.assign(static_cast<size_t>(2 * TAPS_PER_PHASE), 0.0f);
+    delayLeft_.assign(delay, 0.0f);
+    delayRight_.assign(delay, 0.0f);
+    dequeGain_.assign(window, 1.0f);
+    dequeIndex_.assign(window, 0);
+    boxBuffer_.assign(window, 1.0f);
+
+    reset();
+}
+
+void TruePeakLimiter::reset()
+{
+    std::fill(historyLeft_.begin(), historyLeft_.end(), 0.0f);
+    std::fill(historyRight_.begin(), historyRight_.end(), 0.0f);
+    std::fill(delayLeft_.begin(), delayLeft_.end(), 0.0f);
+    std::fill(delayRight_.begin(), delayRight_.end(), 0.0f);
+    std::fill(boxBuffer_.begin(), boxBuffer_.end(), 1.0f);
+
+    historyPos_ = 0;
+    delayPos_ = 0;
+    dequeHead_ = 0;
+    dequeSize_ = 0;
+    sampleIndex_ = 0;
+    boxPos_ = 0;
+    boxSum_ = static_cast<double>(boxBuffer_.size());
+    releaseGain_ = 1.0f;
+}
+
+//==============================================================================
+// Audio Thread
+
+void TruePeakLimiter::process(float* left, float* right, int numSamples)
+{
+    const int window = static_cast<int>(boxBuffer_.size());
+    const int delay = static_cast<int>(delayLeft_.size());
+    const double invWindow = 1.0 / window;
+
+    for (int i = 0; i < numSamples; ++i) {
+        const float peak = detectPeak(left[i], right[i]);
+        const float required = peak > ceiling_ ? ceiling_ / peak : 1.0f;
+        const float windowMin = slidingMinimum(required);
+
+        // Instant down (the box filter below shapes the attack), exponential up
+        releaseGain_ = windowMin < releaseGain_
+            ? windowMin
+            : releaseGain_ + (windowMin - releaseGain_) * releaseCoeff_;
+
+        boxSum_ += releaseGain_ - boxBuffer_[static_cast<size_t>(boxPos_)];
+        boxBuffer_[static_cast<size_t>(boxPos_)] = releaseGain_;
+        boxPos_ = boxPos_ + 1 == window ? 0 : boxPos_ + 1;
+        const float gain = static_cast<float>(boxSum_ * invWindow);
+
+        // Audio delayed by look-ahead + detector delay - gain is down when the peak arrives
+        const float delayedLeft = delayLeft_[static_cast<size_t>(delayPos_)];
+        const float delayedRight = delayRight_[static_cast<size_t>(delayPos_)];
+        delayLeft_[static_cast<size_t>(delayPos_)] = left[i];
+        delayRight_[static_cast<size_t>(delayPos_)] = right[i];
+        delayPos_ = delayPos_ + 1 == delay ? 0 : delayPos_ + 1;
+
+        left[i] = delayedLeft * gain;
+        right[i] = delayedRight * gain;
+    }
+}
+
+float TruePeakLimiter::detectPeak(float left, float right)
+{
+    // Mirrored ring: history[pos + j] == x[n - j] for j < TAPS_PER_PHASE, no wrap in the dot product
+    historyPos_ = historyPos_ == 0 ? TAPS_PER_PHASE - 1 : historyPos_ - 1;
+    historyLeft_[static_cast<size_t>(historyPos_)] = left;
+    historyLeft_[static_cast<size_t>(historyPos_ + TAPS_PER_PHASE)] = left;
+    historyRight_[static_cast<size_t>(historyPos_)] = right;
+    historyRight_[static_cast<size_t>(historyPos_ + TAPS_PER_PHASE)] = right;
+
+    const float* histL = historyLeft_.data() + historyPos_;
+    const float* histR = historyRight_.data() + historyPos_;
+
+    // Sample peak aligned with the detector delay - near Nyquist the lowpass underestimates
+    float peak = std::max(std::abs(histL[detectorDelay_]), std::abs(histR[detectorDelay_]));
+
+    // Phases are the lanes: each tap is broadcast against the OVERSAMPLING phase
+    // coefficients (tap-major layout), and every lane still sums its own taps in
+    // order. No float reassociation is needed, so at -O3 the lane loop becomes
+    // one 4-wide SIMD multiply and add per tap and channel, without fast-math
+    float sumL[OVERSAMPLING] = {};
+    float sumR[OVERSAMPLING] = {};
+    for (int j = 0; j < TAPS_PER_PHASE; ++j) {
+        const float* coeffs = phaseCoefficients_.data() + j * OVERSAMPLING;
+        const float sampleL = histL[j];
+        const float sampleR = histR[j];
+        for (int phase = 0; phase < OVERSAMPLING; ++phase) {
+            sumL[phase] += coeffs[phase] * sampleL;
+            sumR[phase] += coeffs[phase] * sampleR;
+        }
+    }
+
+    for (int phase = 0; phase < OVERSAMPLING; ++phase) {
+        peak = std::max(peak, std::max(std::abs(sumL[phase]), std::abs(sumR[phase])));
+    }
+    return peak;
+}
+
+float TruePeakLimiter::slidingMinimum(float gain)
+{
+    const int capacity = static_cast<int>(dequeGain_.size());
+    const int64_t index = sampleIndex_++;
+
+    // Drop the entry that left the window (front) - indices are unique and the
+    // window advances by one sample, so at most one entry can expire per call
+    if (dequeSize_ > 0 && dequeIndex_[static_cast<size_t>(dequeHead_)] <= index - capacity) {
+        dequeHead_ = dequeHead_ + 1 == capacity ? 0 : dequeHead_ + 1;
+        --dequeSize_;
+    }
+
+    // Drop entries that can never be the minimum (back). One call may pop up to
+    // the whole window, but every entry is popped at most once after its push,
+    // so a block of N samples does at most N + window back pops in total
+    while (dequeSize_ > 0) {
+        const int back = (dequeHead_ + dequeSize_ - 1) % capacity;
+        if (dequeGain_[static_cast<size_t>(back)] < gain) {
+            break;
+        }
+        --dequeSize_;
+    }
+
+    const int slot = (dequeHead_ + dequeSize_) % capacity;
+    dequeGain_[static_cast<size_t>(slot)] = gain;
+    dequeIndex_[static_cast<size_t>(slot)] = index;
+    ++dequeSize_;
+
+    return dequeGain_[static_cast<size_t>(dequeHead_)];
+}
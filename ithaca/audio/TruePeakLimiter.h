@@ -0,0 +1,91 @@
+/**
+ * @file TruePeakLimiter.h
+ * @brief Look-ahead true-peak limiter at the plugin output
+ *
+ * Runs after VoiceManager::finalizeBlock() (the core chain ends with its own
+ * sample-peak limiter). Detection is 4x oversampled through a polyphase FIR,
+ * so inter-sample peaks that a DAC or lossy encoder would reconstruct are
+ * caught as well. The gain curve is the sliding-window minimum of the
+ * required gain (monotonic deque) smoothed by a box filter of the same
+ * length; the audio is delayed by that window, so the gain is fully down
+ * before a peak arrives. Latency is reported to the host by the processor.
+ */
+
+#pragma once
+
+#include "ithaca/config/AppConstants.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TruePeakLimiter
+ * @brief Stereo look-ahead limiter with oversampled true-peak detection
+ *
+ * Features:
+ * - 4x polyphase FIR detector (detection only, the audio path is not resampled)
+ * - Sliding-window minimum via fixed-capacity monotonic deque: O(1) amortized
+ *   per sample; a single sample may pop up to the whole look-ahead window, a
+ *   block of N samples is bounded by 2N + window deque operations
+ * - Box-filter attack over the look-ahead window, exponential release
+ * - All buffers sized in prepare() - process() never allocates
+ */
+class TruePeakLimiter {
+public:
+    static constexpr int OVERSAMPLING = Constants::Audio::TruePeak::OVERSAMPLING;
+    static constexpr int TAPS_PER_PHASE = Constants::Audio::TruePeak::TAPS_PER_PHASE;
+
+    TruePeakLimiter();
+
+    /**
+     * @brief Allocate buffers and design the detector filter (non-RT)
+     * @param sampleRate Host sample rate
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * @brief Clear delay lines and gain state (RT-safe, no allocation)
+     */
+    void reset();
+
+    /**
+     * @brief Limit one block in place (audio thread)
+     */
+    void process(float* left, float* right, int numSamples);
+
+    /**
+     * @brief Added latency in samples (valid after prepare())
+     */
+    int getLatencySamples() const { return lookAheadSamples_ + detectorDelay_; }
+
+private:
+    // Detector
+    std::vector<float> phaseCoefficients_;     ///< TAPS_PER_PHASE x OVERSAMPLING (tap-major)
+    std::vector<float> historyLeft_;           ///< 2 x TAPS_PER_PHASE (mirrored ring)
+    std::vector<float> historyRight_;
+    int historyPos_ = 0;
+    int detectorDelay_ = 0;                    ///< FIR group delay in base-rate samples
+
+    // Look-ahead delay line (audio path)
+    std::vector<float> delayLeft_;
+    std::vector<float> delayRight_;
+    int delayPos_ = 0;
+    int lookAheadSamples_ = 0;
+
+    // Sliding-window minimum of required gain (monotonic deque on a ring)
+    std::vector<float> dequeGain_;
+    std::vector<int64_t> dequeIndex_;
+    int dequeHead_ = 0;
+    int dequeSize_ = 0;
+    int64_t sampleIndex_ = 0;
+
+    // Gain smoothing
+    std::vector<float> boxBuffer_;
+    int boxPos_ = 0;
+    double boxSum_ = 0.0;
+    float releaseGain_ = 1.0f;
+    float releaseCoeff_ = 0.0f;
+    float ceiling_;
+
+    float detectPeak(float left, float right);
+    float slidingMinimum(float gain);
+};
@@ -0,0 +1,265 @@
+/**
+ * @file XrunDetector.cpp
+ * @brief Implementation of callback-timing based xrun detection
+ */
+
+#include "ithaca/audio/XrunDetector.h"
+#include "ithaca/audio/TraceRecorder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr double LATE_THRESHOLD = Constants::Performance::Xruns::LATE_THRESHOLD;
+    constexpr double BASELINE_TRACKING = Constants::Performance::Xruns::BASELINE_TRACKING;
+    constexpr double WARMUP_TRACKING = 0.1;
+    constexpr int WARMUP_CALLBACKS = Constants::Performance::Xruns::WARMUP_CALLBACKS;
+    constexpr auto MAX_CALLBACK_GAP = std::chrono::milliseconds(Constants::Performance::Xruns::MAX_CALLBACK_GAP_MS);
+}
+
+//==============================================================================
+// Constructor / Configuration
+
+XrunDetector::XrunDetector()
+    : sampleRate_(0.0),
+      bufferSize_(0),
+      restartRequested_(false),
+      resetRequested_(false),
+      nonRealtime_(false),
+      lateCallbacks_(0),
+      missedCallbacks_(0),
+      budgetOverruns_(0),
+      callbacks_(0),
+      maxLatenessMs_(0.0),
+      eventsWritten_(0)
+{
+}
+
+void XrunDetector::setAudioSettings(double sampleRate, int bufferSize)
+{
+    sampleRate_.store(sampleRate);
+    bufferSize_.store(bufferSize);
+    restart();
+}
+
+void XrunDetector::restart()
+{
+    restartRequested_.store(true, std::memory_order_release);
+}
+
+void XrunDetector::reset()
+{
+    // Counters are zeroed right away so the GUI reflects the reset even when
+    // no audio is running; the ring is owned by the writer
+    lateCallbacks_.store(0);
+    missedCallbacks_.store(0);
+    budgetOverruns_.store(0);
+    callbacks_.store(0);
+    maxLatenessMs_.store(0.0);
+    resetRequested_.store(true, std::memory_order_release);
+}
+
+//==============================================================================
+// Audio Thread
+
+void XrunDetector::onCallbackStart(std::chrono::steady_clock::time_point now, int numSamples)
+{
+    applyPendingRequests();
+
+    currentBlockSamples_ = numSamples;
+    ++blockIndex_;
+    increment(callbacks_);
+
+    const double sampleRate = sampleRate_.load(std::memory_order_relaxed);
+    const int bufferSize = bufferSize_.load(std::memory_order_relaxed);
+    if (sampleRate <= 0.0 || bufferSize <= 0) {
+        return;
+    }
+
+    // Offline render runs as fast as it can - re-reference once realtime resumes
+    if (nonRealtime_.load(std::memory_order_relaxed)) {
+        hasHistory_ = false;
+        return;
+    }
+
+    // First callback or long pause (transport stop, offline bounce) - new reference
+    if (!hasHistory_ || now - lastCallback_ > MAX_CALLBACK_GAP) {
+        hasHistory_ = true;
+        streamStart_ = now;
+        lastCallback_ = now;
+        renderedSamples_ = numSamples;
+        baselineOffsetNs_ = 0.0;
+        warmupCallbacks_ = WARMUP_CALLBACKS;
+        return;
+    }
+    lastCallback_ = now;
+
+    const double wallNs = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - streamStart_).count());
+    const double audioNs = static_cast<double>(renderedSamples_) * 1.0e9 / sampleRate;
+    const double offsetNs = wallNs - audioNs;
+    renderedSamples_ += numSamples;
+
+    // Stream start: host pre-fill and split blocks settle the reference, no events
+    if (warmupCallbacks_ > 0) {
+        --warmupCallbacks_;
+        baselineOffsetNs_ = offsetNs > baselineOffsetNs_
+            ? offsetNs
+            : baselineOffsetNs_ + (offsetNs - baselineOffsetNs_) * WARMUP_TRACKING;
+        return;
+    }
+
+    const double latenessNs = offsetNs - baselineOffsetNs_;
+    const double periodNs = static_cast<double>(bufferSize) * 1.0e9 / sampleRate;
+    const double latenessMs = latenessNs / 1.0e6;
+    const double periodMs = periodNs / 1.0e6;
+
+    if (latenessMs > maxLatenessMs_.load(std::memory_order_relaxed)) {
+        maxLatenessMs_.store(latenessMs, std::memory_order_relaxed);
+    }
+
+    if (latenessNs > periodNs * LATE_THRESHOLD) {
+        const int missed = static_cast<int>(std::floor(latenessNs / periodNs));
+        if (missed >= 1) {
+            increment(missedCallbacks_, static_cast<uint64_t>(missed));
+            pushEvent(Type::MissedCallback, latenessMs, periodMs, missed);
+        } else {
+            increment(lateCallbacks_);
+            pushEvent(Type::LateCallback, latenessMs, periodMs * LATE_THRESHOLD, 0);
+        }
+
+        // The lost time is gone - measure further callbacks from here
+        baselineOffsetNs_ = offsetNs;
+    } else if (offsetNs > baselineOffsetNs_) {
+        // New least-slack callback within tolerance (burst head, device clock slower) - follow at once
+        baselineOffsetNs_ = offsetNs;
+    } else {
+        // Early callbacks (rest of a burst) pull the envelope back only slowly,
+        // enough to follow drift when the device clock runs faster than the CPU clock
+        baselineOffsetNs_ += (offsetNs - baselineOffsetNs_) * BASELINE_TRACKING;
+    }
+}
+
+bool XrunDetector::onCallbackEnd(int64_t processingNs)
+{
+    const double sampleRate = sampleRate_.load(std::memory_order_relaxed);
+    if (sampleRate <= 0.0 || currentBlockSamples_ <= 0 || nonRealtime_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    const double budgetMs = static_cast<double>(currentBlockSamples_) * 1000.0 / sampleRate
+                          * Constants::Performance::Thresholds::CPU_DROPOUT;
+    const double processingMs = static_cast<double>(processingNs) / 1.0e6;
+
+    if (processingMs <= budgetMs) {
+        return false;
+    }
+
+    increment(budgetOverruns_);
+    pushEvent(Type::BudgetExceeded, processingMs, budgetMs, 0);
+    return true;
+}
+
+//==============================================================================
+// Query
+
+XrunDetector::Counters XrunDetector::getCounters() const
+{
+    Counters counters;
+    counters.lateCallbacks = lateCallbacks_.load(std::memory_order_relaxed);
+    counters.missedCallbacks = missedCallbacks_.load(std::memory_order_relaxed);
+    counters.budgetOverruns = budgetOverruns_.load(std::memory_order_relaxed);
+    counters.callbacks = callbacks_.load(std::memory_order_relaxed);
+    counters.maxLatenessMs = maxLatenessMs_.load(std::memory_order_relaxed);
+    return counters;
+}
+
+int XrunDetector::getRecentEvents(Event* out, int maxEvents) const
+{
+    if (!out || maxEvents <= 0) {
+        return 0;
+    }
+
+    const uint64_t written = eventsWritten_.load(std::memory_order_acquire);
+    const uint64_t available = std::min<uint64_t>(written, static_cast<uint64_t>(std::min(maxEvents, EVENT_RING_SIZE)));
+    int copied = 0;
+
+    for (uint64_t i = written - available; i < written; ++i) {
+        // Skip slots the writer has lapped in the meantime
+        if (eventsWritten_.load(std::memory_order_acquire) - i > static_cast<uint64_t>(EVENT_RING_SIZE)) {
+            continue;
+        }
+
+        const auto& slot = ring_[static_cast<size_t>(i % EVENT_RING_SIZE)];
+        const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // Being written
+        }
+
+        Event event;
+        event.type = static_cast<Type>(slot.type.load(std::memory_order_relaxed));
+        event.wallClockUs = slot.wallClockUs.load(std::memory_order_relaxed);
+        event.blockIndex = slot.blockIndex.load(std::memory_order_relaxed);
+        event.measuredMs = slot.measuredMs.load(std::memory_order_relaxed);
+        event.limitMs = slot.limitMs.load(std::memory_order_relaxed);
+        event.missedCallbacks = slot.missedCallbacks.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != before) {
+            continue;  // Torn read
+        }
+
+        out[copied++] = event;
+    }
+
+    return copied;
+}
+
+const char* XrunDetector::getTypeName(Type type)
+{
+    switch (type) {
+        case Type::LateCallback:   return "late callback";
+        case Type::MissedCallback: return "missed callback";
+        case Type::BudgetExceeded: return "budget exceeded";
+        default:                   return "?";
+    }
+}
+
+//==============================================================================
+// Private Methods
+
+void XrunDetector::applyPendingRequests()
+{
+    if (resetRequested_.exchange(false, std::memory_order_acquire)) {
+        eventsWritten_.store(0, std::memory_order_release);
+    }
+
+    if (restartRequested_.exchange(false, std::memory_order_acquire)) {
+        hasHistory_ = false;
+        blockIndex_ = 0;
+    }
+}
+
+void XrunDetector::pushEvent(Type type, double measuredMs, double limitMs, int missedCallbacks)
+{
+    ITHACA_TRACE_INSTANT(getTypeName(type));
+
+    const uint64_t index = eventsWritten_.load(std::memory_order_relaxed);
+    auto& slot = ring_[static_cast<size_t>(index % EVENT_RING_SIZE)];
+
+    // Seqlock write: odd sequence while the fields are inconsistent
+    const uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto wallClock = std::chrono::system_clock::now().time_since_epoch();
+    slot.type.store(static_cast<int>(type), std::memory_order_relaxed);
+    slot.wallClockUs.store(std::chrono::duration_cast<std::chrono::microseconds>(wallClock).count(),
+                           std::memory_order_relaxed);
+    slot.blockIndex.store(blockIndex_, std::memory_order_relaxed);
+    slot.measuredMs.store(measuredMs, std::memory_order_relaxed);
+    slot.limitMs.store(limitMs, std::memory_order_relaxed);
+    slot.missedCallbacks.store(missedCallbacks, std::memory_order_relaxed);
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    eventsWritten_.store(index + 1, std::memory_order_release);
+}
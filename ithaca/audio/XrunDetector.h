@@ -0,0 +1,182 @@
+/**
+ * @file XrunDetector.h
+ * @brief Callback-timing based xrun detection (late/missed callbacks, budget overruns)
+ *
+ * Deadline model: every callback start is compared with the audio time rendered
+ * so far. slack = audioClock - wallClock; the reference is the lower envelope of
+ * the slack (the latest-starting callbacks), which follows a new minimum at once
+ * and rises only slowly. When a callback's slack drops below the envelope by
+ * more than a fraction of the buffer period it came late, and every full period
+ * is one missed callback. Hosts that bunch callbacks (device buffer larger than
+ * the announced block, anticipative processing) start the first callback of a
+ * burst with the least slack; that callback defines the envelope, so the rest
+ * of the burst is early rather than the head being late against an average.
+ */
+
+#pragma once
+
+#include "ithaca/config/AppConstants.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class XrunDetector
+ * @brief Single-writer (audio thread), multi-reader xrun counters and event ring
+ *
+ * Features:
+ * - Separate counters: late callbacks, missed callbacks, engine budget overruns
+ * - Ring buffer of the last EVENT_RING_SIZE events with wall-clock timestamps
+ *   (correlate with log entries of sample loads, note bursts, ...)
+ * - Slow envelope rise absorbs clock skew between audio device and CPU clock
+ * - Non-realtime (offline) render: callbacks counted, no timing or budget events
+ * - No events during a short warm-up after (re)start (host pre-fill)
+ * - reset()/restart() may be called from any thread - applied by the writer
+ */
+class XrunDetector {
+public:
+    static constexpr int EVENT_RING_SIZE = Constants::Performance::Xruns::EVENT_RING_SIZE;
+
+    /**
+     * @enum Type
+     * @brief Kind of detected xrun
+     */
+    enum class Type {
+        LateCallback,       ///< Callback started later than its deadline allows
+        MissedCallback,     ///< At least one whole buffer period was skipped
+        BudgetExceeded      ///< processBlock took longer than the block's duration
+    };
+
+    /**
+     * @struct Event
+     * @brief One detected xrun
+     */
+    struct Event {
+        Type type = Type::LateCallback;
+        int64_t wallClockUs = 0;        ///< Microseconds since Unix epoch (matches log time)
+        uint64_t blockIndex = 0;        ///< Callback number since the last restart
+        double measuredMs = 0.0;        ///< Lateness or processing time
+        double limitMs = 0.0;           ///< Threshold that was exceeded
+        int missedCallbacks = 0;        ///< MissedCallback only
+    };
+
+    /**
+     * @struct Counters
+     * @brief Totals since the last reset
+     */
+    struct Counters {
+        uint64_t lateCallbacks = 0;
+        uint64_t missedCallbacks = 0;   ///< Number of skipped periods (not events)
+        uint64_t budgetOverruns = 0;
+        uint64_t callbacks = 0;
+        double maxLatenessMs = 0.0;     ///< Worst callback lateness (jitter) seen
+    };
+
+    XrunDetector();
+
+    /**
+     * @brief Update audio settings and restart timing (call from prepareToPlay)
+     * @param sampleRate Sample rate in Hz
+     * @param bufferSize Nominal (maximum) block size
+     */
+    void setAudioSettings(double sampleRate, int bufferSize);
+
+    /**
+     * @brief Forget callback history (stream restarted, transport paused, ...)
+     */
+    void restart();
+
+    /**
+     * @brief Host renders offline - callback timing and budget carry no meaning (any thread)
+     */
+    void setNonRealtime(bool nonRealtime) { nonRealtime_.store(nonRealtime, std::memory_order_relaxed); }
+
+    /**
+     * @brief Reset counters and event ring (any thread)
+     */
+    void reset();
+
+    //==========================================================================
+    // Audio thread (RT-safe)
+
+    /**
+     * @brief Callback started
+     * @param now Callback start time
+     * @param numSamples Samples requested in this callback
+     */
+    void onCallbackStart(std::chrono::steady_clock::time_point now, int numSamples);
+
+    /**
+     * @brief Callback finished
+     * @param processingNs Time spent in processBlock
+     * @return true if the engine budget was exceeded
+     */
+    bool onCallbackEnd(int64_t processingNs);
+
+    //==========================================================================
+    // Query (any thread, lock-free)
+
+    Counters getCounters() const;
+
+    /**
+     * @brief Copy the most recent events, oldest first
+     * @param out Destination array
+     * @param maxEvents Capacity of out
+     * @return Number of events copied
+     */
+    int getRecentEvents(Event* out, int maxEvents) const;
+
+    static const char* getTypeName(Type type);
+
+private:
+    /**
+     * @struct Slot
+     * @brief Ring entry guarded by a sequence number (odd = being written)
+     */
+    struct Slot {
+        std::atomic<uint64_t> sequence { 0 };
+        std::atomic<int> type { 0 };
+        std::atomic<int64_t> wallClockUs { 0 };
+        std::atomic<uint64_t> blockIndex { 0 };
+        std::atomic<double> measuredMs { 0.0 };
+        std::atomic<double> limitMs { 0.0 };
+        std::atomic<int> missedCallbacks { 0 };
+    };
+
+    // Settings (written from prepareToPlay)
+    std::atomic<double> sampleRate_;
+    std::atomic<int> bufferSize_;
+    std::atomic<bool> restartRequested_;
+    std::atomic<bool> resetRequested_;
+    std::atomic<bool> nonRealtime_;
+
+    // Timing state (audio thread only)
+    bool hasHistory_ = false;
+    std::chrono::steady_clock::time_point streamStart_;
+    std::chrono::steady_clock::time_point lastCallback_;
+    int64_t renderedSamples_ = 0;       ///< Samples rendered since streamStart_
+    double baselineOffsetNs_ = 0.0;     ///< wallClock - audioClock of the least-slack envelope
+    int warmupCallbacks_ = 0;
+    int currentBlockSamples_ = 0;
+    uint64_t blockIndex_ = 0;
+
+    // Counters (single writer)
+    std::atomic<uint64_t> lateCallbacks_;
+    std::atomic<uint64_t> missedCallbacks_;
+    std::atomic<uint64_t> budgetOverruns_;
+    std::atomic<uint64_t> callbacks_;
+    std::atomic<double> maxLatenessMs_;
+
+    // Event ring (single writer)
+    std::array<Slot, EVENT_RING_SIZE> ring_;
+    std::atomic<uint64_t> eventsWritten_;
+
+    void applyPendingRequests();
+    void pushEvent(Type type, double measuredMs, double limitMs, int missedCallbacks);
+
+    static void increment(std::atomic<uint64_t>& counter, uint64_t amount = 1)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+};
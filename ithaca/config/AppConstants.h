@@ -134,6 +134,29 @@ namespace Constants {
             constexpr int DEFAULT_BUFFER = 512;
             constexpr int MAX_BUFFER = 2048;
         }
+
+        namespace ReleaseTriggers {
+            constexpr const char* DEFAULT_DIRECTORY = "release";  // Podadresář sample banky
+            constexpr int DEFAULT_VOICES = 16;                    // Max viz ITHACA_MAX_RELEASE_VOICES
+            constexpr double STEAL_FADE_MS = 5.0;                 // Fade-out ukradeného voice (bez kliku)
+        }
+
+        namespace TruePeak {
+            constexpr double CEILING_DB = -1.0;                   // dBTP
+            constexpr double LOOKAHEAD_MS = 1.5;                  // attack window = audio delay
+            constexpr double RELEASE_MS = 50.0;
+            constexpr int OVERSAMPLING = 4;                       // detector rate factor
+            constexpr int TAPS_PER_PHASE = 12;                    // 48-tap interpolation FIR
+        }
+
+        namespace Idle {
+            constexpr float SILENCE_THRESHOLD = 1.0e-5f;          // -100 dBFS - below = silent
+            constexpr double TAIL_HOLD_MS = 500.0;                // DSP tail quiet this long = at rest
+        }
+
+        namespace Housekeeping {
+            constexpr int TIMER_INTERVAL_MS = 250;                // message-thread úklid (vyřazené pooly)
+        }
     }
 
     // ========================================================================
@@ -141,6 +164,7 @@ namespace Constants {
     // ========================================================================
     namespace Performance {
         constexpr int MONITORING_WINDOW_SIZE = 100;  // samples for averaging
+        constexpr int HISTOGRAM_WINDOW_BLOCKS = 2048; // blocks per latency histogram window (~20 s @ 512/48k)
 
         namespace Thresholds {
             constexpr double CPU_OK = 0.50;         // < 50% = OK
@@ -149,6 +173,20 @@ namespace Constants {
             constexpr double CPU_DROPOUT = 1.00;    // >= 100% = dropout
         }
 
+        namespace Xruns {
+            constexpr int EVENT_RING_SIZE = 64;             // last xrun events kept with timestamps
+            constexpr double LATE_THRESHOLD = 0.5;          // lateness > 0.5 buffer period = late callback
+            constexpr int MAX_CALLBACK_GAP_MS = 500;        // longer gap = host paused, restart timing
+            constexpr double BASELINE_TRACKING = 0.001;     // per-block drift follow rate (clock skew)
+            constexpr int WARMUP_CALLBACKS = 32;            // no events right after (re)start
+        }
+
+        namespace Metrics {
+            constexpr double WINDOW_SECONDS = 1.0;          // averaging window of rates (audio time)
+            constexpr int DUMP_INTERVAL_MS = 10000;         // JSON-line metrics log period
+            constexpr const char* LOG_FILE_NAME = "ithaca-metrics.jsonl";
+        }
+
         namespace Colors {
             constexpr juce::uint32 OK = 0xff90ee90;        // lightgreen
             constexpr juce::uint32 WARNING = 0xffffa500;   // orange
@@ -204,6 +242,17 @@ namespace Constants {
             constexpr uint8_t CENTER = 64;  // For pan, pedals
         }
 
+        namespace Pedals {
+            constexpr float SOFT_PEDAL_ATTENUATION = 0.7f;  // Una corda útlum (~-3 dB)
+            constexpr int SOFT_PEDAL_LAYER_SHIFT = 1;       // Posun o N velocity vrstev dolů
+
+            // Half-pedaling (CC64): pod HALF_MIN tlumí dampery plně, v zóně HALF_MIN..HALF_MAX
+            // se prodlužuje release. Držení not zůstává na ccValueToPedalState (≥ 64).
+            constexpr uint8_t DAMPER_HALF_MIN = 16;
+            constexpr uint8_t DAMPER_HALF_MAX = Values::CENTER;
+            constexpr int DAMPER_RELEASE_STEP = 4;          // Min. změna release pro zápis do 128 voices
+        }
+
         namespace Processing {
             constexpr int MAX_MESSAGES_PER_BLOCK = 32;
             constexpr bool ENABLE_CC_PROCESSING = true;
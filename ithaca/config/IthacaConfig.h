@@ -28,6 +28,8 @@
 
 // Voice management
 #define ITHACA_MAX_VOICES 128
+#define ITHACA_MAX_RELEASE_VOICES 32    // Release-trigger pool (separate from main voices)
+#define ITHACA_COMPACT_RELEASE_SAMPLES 1  // 16-bit release WAVs stay int16 in memory (half of float)
 #define ITHACA_MAX_VELOCITY_LAYERS 8
 #define ITHACA_DEFAULT_VOICE_GAIN 1.0f
 
@@ -128,6 +130,9 @@
 #define ITHACA_ENABLE_RT_SAFETY_CHECKS 1
 #define ITHACA_VOICE_POOL_PREALLOCATE 1
 #define ITHACA_ENABLE_DENORMAL_PROTECTION 1
+#define ITHACA_ENABLE_STAGE_PROFILING 1      // processBlock stage probes (PerformanceMonitor::ScopedStage)
+#define ITHACA_ENABLE_TRACING 1              // Timeline trace probes (TraceRecorder, enabled via ITHACA_TRACE=1)
+#define ITHACA_TRUE_PEAK_LIMITER 0           // Default of the "truePeakLimiter" parameter (look-ahead, adds ~1.6 ms latency)
 
 // ============================================================================
 // DEBUG - Development & Testing
@@ -9,6 +9,7 @@
 
 #include "ithaca/gui/components/InfoHeaderComponent.h"
 #include "ithaca/config/AppConstants.h"
+#include "ithaca/audio/TraceRecorder.h"
 #include "BuildID.h"
 #include <iostream>
 
@@ -73,6 +74,8 @@ void InfoHeaderComponent::resized()
 
 void InfoHeaderComponent::timerCallback()
 {
+    ITHACA_TRACE_THREAD("GUI");
+    ITHACA_TRACE_SCOPE("InfoHeader::timerCallback");
     updateLiveData();
 }
 
@@ -214,15 +217,20 @@ void InfoHeaderComponent::updateLiveData()
 
         // CPU Usage with color-coded indication
         if (labelBundle_.cpuUsageLabel) {
+            const int xrunCount = stats.dropoutCount + stats.lateCallbacks + stats.missedCallbacks;
             juce::String cpuText = "CPU: " +
-                juce::String(stats.cpuUsagePercent, 1) + "% | Dropouts: " +
-                juce::String(stats.dropoutCount);
+                juce::String(stats.cpuUsagePercent, 1) + "% | p99: " +
+                juce::String(stats.p99ProcessingTimeMs, 2) + " ms | Xruns: " +
+                juce::String(xrunCount);
+            if (stats.engineAsleep) {
+                cpuText += " | Idle";
+            }
 
             labelBundle_.cpuUsageLabel->setText(cpuText, juce::dontSendNotification);
 
             // Color-coded CPU status
             juce::Colour cpuColor;
-            if (stats.dropoutCount > 0 || stats.cpuUsagePercent > 80.0) {
+            if (xrunCount > 0 || stats.cpuUsagePercent > 80.0) {
                 cpuColor = juce::Colours::red;        // Critical (RED)
             } else if (stats.cpuUsagePercent > 50.0) {
                 cpuColor = juce::Colours::orange;     // Warning (ORANGE)
@@ -233,6 +241,13 @@ void InfoHeaderComponent::updateLiveData()
             labelBundle_.cpuUsageLabel->setColour(juce::Label::textColourId, cpuColor);
         }
 
+        // processBlock stage breakdown (debug panel only)
+        if (labelBundle_.stageTimingLabel && stats.stageBreakdown.blocks > 0) {
+            labelBundle_.stageTimingLabel->setText(
+                PerformanceMonitor::formatStageBreakdown(stats.stageBreakdown),
+                juce::dontSendNotification);
+        }
+
     } else {
         // No VoiceManager yet
         if (labelBundle_.activeVoicesLabel) {
@@ -258,6 +273,7 @@ InfoHeaderLabels InfoHeaderComponent::getLabelsForLayout() const
     labels.activeVoicesLabel = labelBundle_.activeVoicesLabel.get();
     labels.sustainingVoicesLabel = labelBundle_.sustainingVoicesLabel.get();
     labels.cpuUsageLabel = labelBundle_.cpuUsageLabel.get();
+    labels.stageTimingLabel = labelBundle_.stageTimingLabel.get();
 
     return labels;
 }
\ No newline at end of file
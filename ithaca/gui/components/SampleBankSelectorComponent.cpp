@@ -64,7 +64,10 @@ void SampleBankSelectorComponent::updateStatus() {
     juce::String currentPath = processorRef_.getLoadedSampleBankPath();
 
     // Update label with current state
-    if (currentPath.isEmpty()) {
+    if (processorRef_.isLoadingInProgress()) {
+        sampleBankLabel_.setText("Sample Bank: " + formatLoadProgress(processorRef_.getLoadProgress()),
+                                juce::dontSendNotification);
+    } else if (currentPath.isEmpty()) {
         sampleBankLabel_.setText("Sample Bank: Sine Wave Test Tone",
                                 juce::dontSendNotification);
     } else {
@@ -115,6 +118,22 @@ void SampleBankSelectorComponent::loadButtonClicked() {
     });
 }
 
+juce::String SampleBankSelectorComponent::formatLoadProgress(const AsyncSampleLoader::LoadProgress& progress) {
+    using Phase = AsyncSampleLoader::LoadPhase;
+
+    switch (progress.phase) {
+        case Phase::Scanning:
+            return "Scanning...";
+        case Phase::Decoding:
+            return "Decoding " + juce::String(progress.filesTotal) + " files...";
+        case Phase::ReleaseTriggers:
+            return "Loading release triggers...";
+        case Phase::Idle:
+        default:
+            return "Loading...";
+    }
+}
+
 juce::String SampleBankSelectorComponent::getSampleBankNameFromPath(const juce::String& path) const {
     if (path.isEmpty()) {
         return "None";
@@ -105,6 +105,13 @@ private:
      */
     void loadButtonClicked();
 
+    /**
+     * @brief Format running load for the status label
+     * @param progress Loader progress snapshot
+     * @return e.g. "Decoding 704 files..."
+     */
+    static juce::String formatLoadProgress(const AsyncSampleLoader::LoadProgress& progress);
+
     /**
      * @brief Get sample bank name from path
      * @param path Full path to sample bank directory
@@ -43,9 +43,14 @@ InfoHeaderLabelBundle InfoHeaderLabelFactory::createAllLabels(
 
     // CPU usage - SMALL FONT (11px, color-coded)
     bundle.cpuUsageLabel = GuiHelpers::createSmallLabel(
-        "CPU: 0% | Dropouts: 0",
+        "CPU: 0% | p99: 0.00 ms | Xruns: 0",
         debugMode);
 
+    // processBlock stage breakdown - debug panel only
+    if (debugMode) {
+        bundle.stageTimingLabel = GuiHelpers::createSmallLabel("Stages: --", debugMode);
+    }
+
     return bundle;
 }
 
@@ -70,6 +75,9 @@ void InfoHeaderLabelFactory::addToComponent(juce::Component& parent,
     if (bundle.cpuUsageLabel) {
         parent.addAndMakeVisible(bundle.cpuUsageLabel.get());
     }
+    if (bundle.stageTimingLabel) {
+        parent.addAndMakeVisible(bundle.stageTimingLabel.get());
+    }
 }
 
 //==============================================================================
@@ -25,6 +25,7 @@ struct InfoHeaderLabelBundle {
     std::unique_ptr<juce::Label> activeVoicesLabel;
     std::unique_ptr<juce::Label> sustainingVoicesLabel;
     std::unique_ptr<juce::Label> cpuUsageLabel;
+    std::unique_ptr<juce::Label> stageTimingLabel;  ///< Debug mode only
 };
 
 /**
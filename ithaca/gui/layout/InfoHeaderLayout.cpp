@@ -107,5 +107,11 @@ void InfoHeaderLayout::applyDebugMode(juce::Rectangle<int> bounds,
     // CPU usage (full width)
     if (labels.cpuUsageLabel) {
         labels.cpuUsageLabel->setBounds(bounds.removeFromTop(labelHeight));
+        bounds.removeFromTop(spacing);
+    }
+
+    // processBlock stage breakdown (full width)
+    if (labels.stageTimingLabel) {
+        labels.stageTimingLabel->setBounds(bounds.removeFromTop(labelHeight));
     }
 }
@@ -21,6 +21,7 @@ struct InfoHeaderLabels {
     juce::Label* activeVoicesLabel = nullptr;
     juce::Label* sustainingVoicesLabel = nullptr;
     juce::Label* cpuUsageLabel = nullptr;
+    juce::Label* stageTimingLabel = nullptr;    ///< Debug mode only (nullptr otherwise)
 };
 
 /**
@@ -17,6 +17,20 @@ namespace MidiHelpers {
         return ccNumber == Constants::Midi::CC::DAMPER_PEDAL;
     }
 
+    /**
+     * @brief Check if CC number is Sostenuto Pedal (CC66)
+     */
+    inline bool isSostenutoPedal(uint8_t ccNumber) {
+        return ccNumber == Constants::Midi::CC::SOSTENUTO;
+    }
+
+    /**
+     * @brief Check if CC number is Soft Pedal / una corda (CC67)
+     */
+    inline bool isSoftPedal(uint8_t ccNumber) {
+        return ccNumber == Constants::Midi::CC::SOFT_PEDAL;
+    }
+
     /**
      * @brief Convert MIDI CC value (0-127) to normalized parameter value (0.0-1.0)
      */
@@ -33,11 +33,11 @@ void MidiProcessor::processSingleEvent(const juce::MidiMessage& message,
     if (message.isNoteOn()) {
         uint8_t midiNote = static_cast<uint8_t>(message.getNoteNumber());
         uint8_t velocity = static_cast<uint8_t>(message.getVelocity());
-        voiceManager->setNoteStateMIDI(midiNote, true, velocity);
+        pedalProcessor_.processNoteOn(midiNote, velocity, voiceManager);
     }
     else if (message.isNoteOff()) {
         uint8_t midiNote = static_cast<uint8_t>(message.getNoteNumber());
-        voiceManager->setNoteStateMIDI(midiNote, false);
+        pedalProcessor_.processNoteOff(midiNote, voiceManager);
     }
     else if (message.isController()) {
         uint8_t ccNumber = static_cast<uint8_t>(message.getControllerNumber());
@@ -49,6 +49,16 @@ void MidiProcessor::processSingleEvent(const juce::MidiMessage& message,
             return;
         }
 
+        // PRIORITA 1b: Sostenuto (CC66) a Soft Pedal (CC67)
+        if (MidiHelpers::isSostenutoPedal(ccNumber)) {
+            pedalProcessor_.processSostenuto(ccValue, voiceManager);
+            return;
+        }
+        if (MidiHelpers::isSoftPedal(ccNumber)) {
+            pedalProcessor_.processSoftPedal(ccValue);
+            return;
+        }
+
         // PRIORITA 2: MIDI Learn (pokud je aktivní)
         if (midiLearnManager && midiLearnManager->isLearning()) {
             if (midiLearnManager->tryLearnCC(ccNumber)) {
@@ -95,18 +105,14 @@ void MidiProcessor::processSustainPedal(uint8_t ccValue, VoiceManager* voiceMana
 {
     if (!voiceManager) return;
     
-    // Convert MIDI value to pedal state
-    // Standard MIDI: ≤63 = OFF, ≥64 = ON
-    bool pedalDown = MidiHelpers::ccValueToPedalState(ccValue);
-    
-    // Delegate to VoiceManager (RT-safe)
-    voiceManager->setSustainPedalMIDI(pedalDown);
+    // Continuous damper model (half-pedaling) - see PedalProcessor::processDamper()
+    pedalProcessor_.processDamper(ccValue, voiceManager);
     
     // Optional: Log in debug mode (non-RT context only)
 #if ENABLE_MIDI_CC_LOGGING
     std::cout << "[MidiProcessor] Sustain Pedal (CC64): " 
-              << (pedalDown ? "DOWN" : "UP") 
-              << " (value=" << static_cast<int>(ccValue) << ")" 
+              << static_cast<int>(ccValue)
+              << (pedalProcessor_.isDamperHeld() ? " (held)" : "")
               << std::endl;
 #endif
 }
@@ -8,6 +8,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <atomic>
 #include <cstdint>
+#include "ithaca/midi/PedalProcessor.h"
 
 // Forward declarations
 class VoiceManager;
@@ -58,6 +59,16 @@ public:
     
     int getTotalMidiEventsProcessed() const;
     void resetStatistics();
+
+    // ========================================================================
+    // Pedals (Sostenuto, Soft Pedal)
+    // ========================================================================
+
+    /**
+     * @brief Access pedal processor (audio thread only)
+     * @return Reference na PedalProcessor
+     */
+    PedalProcessor& getPedalProcessor() { return pedalProcessor_; }
     
 private:
     // ========================================================================
@@ -78,10 +89,10 @@ private:
     
     /**
      * @brief Process Sustain Pedal (CC64) messages
-     * @param ccValue MIDI CC value (0-127, ≤63=off, ≥64=on)
+     * @param ccValue MIDI CC value (0-127, spojitý - half-pedaling)
      * @param voiceManager Pointer na VoiceManager
      * @note NOVĚ PŘIDÁNO: Separátní handling pro CC64 damper pedal
-     * @note RT-safe: deleguje na VoiceManager::setSustainPedalMIDI()
+     * @note RT-safe: deleguje na PedalProcessor::processDamper()
      */
     void processSustainPedal(uint8_t ccValue, VoiceManager* voiceManager);
     
@@ -101,4 +112,6 @@ private:
     // ========================================================================
     
     std::atomic<int> totalMidiEventsProcessed_{0};
+
+    PedalProcessor pedalProcessor_;  ///< Sostenuto + una corda state
 };
\ No newline at end of file
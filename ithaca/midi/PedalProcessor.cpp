@@ -0,0 +1,267 @@
+/**
+ * @file PedalProcessor.cpp
+ * @brief Implementace damper (half-pedal), sostenuto a una corda pedálu
+ */
+
+#include "ithaca/midi/PedalProcessor.h"
+#include "ithaca/midi/MidiHelpers.h"
+#include "ithaca/audio/ReleaseTriggerPool.h"
+#include "ithaca/config/IthacaConfig.h"
+#include "ithaca-core/sampler/voice_manager.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+// ============================================================================
+// Damper Lift Table (compile-time)
+// ============================================================================
+
+namespace {
+
+    /**
+     * @brief Zdvih damperu 0.0-1.0 pro každou CC64 hodnotu
+     *
+     * V half-pedal zóně smoothstep křivka (plynulý náběh i doběh),
+     * počítáno v compile-time - žádná matematika v audio threadu.
+     */
+    constexpr std::array<float, 128> makeDamperLiftTable()
+    {
+        std::array<float, 128> table {};
+        constexpr float span = static_cast<float>(Constants::Midi::Pedals::DAMPER_HALF_MAX -
+                                                  Constants::Midi::Pedals::DAMPER_HALF_MIN);
+
+        for (int cc = 0; cc < 128; ++cc) {
+            if (cc <= Constants::Midi::Pedals::DAMPER_HALF_MIN) {
+                table[cc] = 0.0f;
+            } else if (cc >= Constants::Midi::Pedals::DAMPER_HALF_MAX) {
+                table[cc] = 1.0f;
+            } else {
+                const float x = (cc - Constants::Midi::Pedals::DAMPER_HALF_MIN) / span;
+                table[cc] = x * x * (3.0f - 2.0f * x);
+            }
+        }
+        return table;
+    }
+
+    constexpr std::array<float, 128> DAMPER_LIFT_TABLE = makeDamperLiftTable();
+
+} // namespace
+
+// ============================================================================
+// Note Events
+// ============================================================================
+
+void PedalProcessor::processNoteOn(uint8_t midiNote, uint8_t velocity, VoiceManager* voiceManager)
+{
+    if (!voiceManager) return;
+
+    keysDown_.set(midiNote);
+    pendingNoteOff_.reset(midiNote);  // Re-strike zachycené noty ruší odložený note-off
+    damperSustained_.reset(midiNote);
+
+    // Una corda: gain voice se mění pouze při změně una corda stavu noty,
+    // re-strike se stejným stavem nesahá na gain doznívajícího voice
+    if (softPedalDown_) {
+        velocity = applySoftPedalVelocity(velocity);
+    }
+    if (softPedalDown_ != softStruck_.test(midiNote)) {
+        if (softPedalDown_) {
+            softStruck_.set(midiNote);
+        } else {
+            softStruck_.reset(midiNote);
+        }
+        applyVoiceGain(midiNote, voiceManager);
+    }
+
+    voiceManager->setNoteStateMIDI(midiNote, true, velocity);
+
+    if (releasePool_) {
+        releasePool_->noteOn(midiNote, velocity);
+    }
+}
+
+void PedalProcessor::processNoteOff(uint8_t midiNote, VoiceManager* voiceManager)
+{
+    if (!voiceManager) return;
+
+    keysDown_.reset(midiNote);
+
+    // Sostenuto drží notu až do uvolnění pedálu
+    if (sostenutoLatched_.test(midiNote)) {
+        pendingNoteOff_.set(midiNote);
+        return;
+    }
+
+    voiceManager->setNoteStateMIDI(midiNote, false);
+    releaseKey(midiNote);
+}
+
+// ============================================================================
+// Pedal Events
+// ============================================================================
+
+void PedalProcessor::processDamper(uint8_t ccValue, VoiceManager* voiceManager)
+{
+    if (!voiceManager) return;
+
+    damperValue_ = std::min(ccValue, Constants::Midi::Values::MAX);
+    const bool held = MidiHelpers::ccValueToPedalState(damperValue_);
+
+    // Release nastavit před uvolněním pedálu, aby noty doznívaly už s novou délkou
+    applyDamperRelease(voiceManager);
+
+    if (held != damperHeld_) {
+        damperHeld_ = held;
+        voiceManager->setSustainPedalMIDI(held);
+
+        // Dampery dopadly na struny uvolněných not
+        if (!held) {
+            if (releasePool_) {
+                damperSustained_.forEach([this](uint8_t note) {
+                    releasePool_->trigger(note);
+                });
+            }
+            damperSustained_.clear();
+        }
+    }
+}
+
+void PedalProcessor::processSostenuto(uint8_t ccValue, VoiceManager* voiceManager)
+{
+    const bool pedalDown = MidiHelpers::ccValueToPedalState(ccValue);
+    if (pedalDown == sostenutoDown_) {
+        return;  // Opakované CC se stejným stavem nic nemění
+    }
+    sostenutoDown_ = pedalDown;
+
+    if (pedalDown) {
+        // Zachytit pouze noty, které jsou právě drženy
+        sostenutoLatched_ = keysDown_;
+        pendingNoteOff_.clear();
+        return;
+    }
+
+    // Pedál uvolněn - dohrát odložené note-off
+    // (damper pedal případně noty dál drží uvnitř VoiceManageru)
+    if (voiceManager) {
+        pendingNoteOff_.forEach([this, voiceManager](uint8_t note) {
+            voiceManager->setNoteStateMIDI(note, false);
+            releaseKey(note);
+        });
+    }
+
+    sostenutoLatched_.clear();
+    pendingNoteOff_.clear();
+}
+
+void PedalProcessor::processSoftPedal(uint8_t ccValue)
+{
+    softPedalDown_ = MidiHelpers::ccValueToPedalState(ccValue);
+}
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+void PedalProcessor::setVelocityLayerCount(int velocityLayerCount)
+{
+    velocityLayerCount_ = std::clamp(velocityLayerCount, 1, ITHACA_MAX_VELOCITY_LAYERS);
+}
+
+void PedalProcessor::setUserReleaseMIDI(uint8_t releaseMIDI, VoiceManager* voiceManager)
+{
+    userReleaseMIDI_ = releaseMIDI;
+    applyDamperRelease(voiceManager);
+}
+
+void PedalProcessor::setMasterGainMIDI(uint8_t masterGainMIDI, VoiceManager* voiceManager)
+{
+    masterGainMIDI_ = masterGainMIDI;
+    if (!voiceManager) return;
+
+    for (int note = 0; note < 128; ++note) {
+        applyVoiceGain(static_cast<uint8_t>(note), voiceManager);
+    }
+}
+
+void PedalProcessor::reset(VoiceManager* voiceManager)
+{
+    // Zachycené noty patří předchozímu VoiceManageru
+    sostenutoLatched_.clear();
+    pendingNoteOff_.clear();
+    damperSustained_.clear();
+    softStruck_.clear();
+
+    // Stav pedálů zůstává - nový VoiceManager ho musí převzít
+    if (!voiceManager) return;
+
+    voiceManager->setSustainPedalMIDI(damperHeld_);
+    appliedReleaseMIDI_ = RELEASE_NOT_APPLIED;
+    applyDamperRelease(voiceManager);
+    setMasterGainMIDI(masterGainMIDI_, voiceManager);
+}
+
+uint8_t PedalProcessor::computeDamperReleaseMIDI(uint8_t userReleaseMIDI, uint8_t damperValue)
+{
+    const float lift = DAMPER_LIFT_TABLE[damperValue & 0x7F];
+    const int headroom = Constants::Midi::Values::MAX - userReleaseMIDI;
+    return static_cast<uint8_t>(userReleaseMIDI + static_cast<int>(headroom * lift + 0.5f));
+}
+
+// ============================================================================
+// Private Helpers
+// ============================================================================
+
+void PedalProcessor::applyDamperRelease(VoiceManager* voiceManager)
+{
+    if (!voiceManager) return;
+
+    const uint8_t release = computeDamperReleaseMIDI(userReleaseMIDI_, damperValue_);
+    if (release == appliedReleaseMIDI_) {
+        return;
+    }
+
+    // Krajní hodnoty (dampery dole / plný zdvih) vždy, mezi nimi po krocích
+    const bool endpoint = release == userReleaseMIDI_ || release == Constants::Midi::Values::MAX;
+    if (endpoint ||
+        std::abs(static_cast<int>(release) - static_cast<int>(appliedReleaseMIDI_)) >=
+            Constants::Midi::Pedals::DAMPER_RELEASE_STEP) {
+        appliedReleaseMIDI_ = release;
+        voiceManager->setAllVoicesReleaseMIDI(release);  // RT-safe
+    }
+}
+
+void PedalProcessor::applyVoiceGain(uint8_t midiNote, VoiceManager* voiceManager) const
+{
+    float gain = masterGainMIDI_ / 127.0f;
+    if (softStruck_.test(midiNote)) {
+        gain *= Constants::Midi::Pedals::SOFT_PEDAL_ATTENUATION;
+    }
+    voiceManager->getVoiceMIDI(midiNote).setMasterGain(gain);
+}
+
+void PedalProcessor::releaseKey(uint8_t midiNote)
+{
+    if (!releasePool_) return;
+
+    if (damperHeld_) {
+        damperSustained_.set(midiNote);  // Zazní až při uvolnění damperu
+    } else {
+        releasePool_->trigger(midiNote);
+    }
+}
+
+uint8_t PedalProcessor::applySoftPedalVelocity(uint8_t velocity) const
+{
+    // Šířka jedné velocity vrstvy v MIDI velocity rozsahu.
+    // Předpoklad: IthacaCore dělí velocity 0-127 na stejně široké vrstvy
+    // (lineární mapování velocity -> vrstva). VoiceManager hranice vrstev
+    // nevystavuje; při nelineárním mapování v jádře posun odpovídá přibližně
+    // SOFT_PEDAL_LAYER_SHIFT vrstvám, ne přesně.
+    const int layerWidth = (Constants::Midi::Values::MAX + 1) / velocityLayerCount_;
+    const int shifted = static_cast<int>(velocity) -
+                        layerWidth * Constants::Midi::Pedals::SOFT_PEDAL_LAYER_SHIFT;
+
+    // Velocity 0 by VoiceManager interpretoval jako Note Off
+    return static_cast<uint8_t>(std::max(shifted, 1));
+}
@@ -0,0 +1,230 @@
+/**
+ * @file PedalProcessor.h
+ * @brief Damper (CC64), Sostenuto (CC66) a Soft Pedal / una corda (CC67) handling
+ *
+ * VoiceManager z IthacaCore zná pouze binární damper pedal (setSustainPedalMIDI).
+ * Ostatní pedálová logika je proto řešena zde, nad VoiceManager API:
+ * - Damper je spojitý: v half-pedal zóně prodlužuje release podle tabulky
+ * - Sostenuto drží note-off pro noty, které byly stisknuté v okamžiku sešlápnutí
+ * - Una corda posune velocity o jednu velocity vrstvu dolů a ztlumí voice
+ *   (útlum je součástí master gainu noty - ParameterManager ho zapisuje přes PedalProcessor)
+ * - Release-trigger samply se spouští v okamžiku, kdy na strunu dopadne damper
+ *
+ * Vše běží v sample-accurate MIDI smyčce (processSingleEvent), bez alokací.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Forward declarations
+class VoiceManager;
+class ReleaseTriggerPool;
+
+/**
+ * @struct NoteMask
+ * @brief 128-bit maska MIDI not (jeden bit na notu = jeden voice)
+ *
+ * Všechny operace jsou O(1) nad dvěma 64-bit slovy, iterace přes
+ * nastavené bity přeskakuje prázdná místa (count-trailing-zeros).
+ */
+struct NoteMask {
+    uint64_t words[2] = { 0, 0 };
+
+    void set(uint8_t note)         { words[(note >> 6) & 1] |=  (uint64_t(1) << (note & 63)); }
+    void reset(uint8_t note)       { words[(note >> 6) & 1] &= ~(uint64_t(1) << (note & 63)); }
+    bool test(uint8_t note) const  { return (words[(note >> 6) & 1] >> (note & 63)) & 1; }
+    bool any() const               { return (words[0] | words[1]) != 0; }
+    void clear()                   { words[0] = 0; words[1] = 0; }
+
+    /**
+     * @brief Zavolá callback pro každou nastavenou notu (vzestupně)
+     */
+    template <typename Callback>
+    void forEach(Callback&& callback) const {
+        for (int w = 0; w < 2; ++w) {
+            uint64_t bits = words[w];
+            while (bits != 0) {
+                const int bit = countTrailingZeros(bits);
+                callback(static_cast<uint8_t>((w << 6) + bit));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+private:
+    static int countTrailingZeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+#else
+        int count = 0;
+        while ((value & 1) == 0) { value >>= 1; ++count; }
+        return count;
+#endif
+    }
+};
+
+/**
+ * @class PedalProcessor
+ * @brief Pedálová logika pro sample-accurate MIDI loop
+ *
+ * Note On/Off prochází přes PedalProcessor, který je pak deleguje na
+ * VoiceManager::setNoteStateMIDI(). Držení not plně sešlápnutým damperem
+ * zůstává ve VoiceManager, half-pedal zóna mění release všech voices.
+ *
+ * Thread Safety:
+ * - Všechny metody se volají pouze z audio threadu
+ */
+class PedalProcessor {
+public:
+    PedalProcessor() = default;
+
+    // ========================================================================
+    // Note Events
+    // ========================================================================
+
+    /**
+     * @brief Note On s una corda úpravou velocity a gainu
+     * @param midiNote MIDI nota (0-127)
+     * @param velocity MIDI velocity (1-127)
+     * @param voiceManager Pointer na VoiceManager
+     */
+    void processNoteOn(uint8_t midiNote, uint8_t velocity, VoiceManager* voiceManager);
+
+    /**
+     * @brief Note Off - pokud je nota zachycena sostenutem, odloží se
+     * @param midiNote MIDI nota (0-127)
+     * @param voiceManager Pointer na VoiceManager
+     */
+    void processNoteOff(uint8_t midiNote, VoiceManager* voiceManager);
+
+    // ========================================================================
+    // Pedal Events
+    // ========================================================================
+
+    /**
+     * @brief Damper pedal (CC64) - spojitý model s half-pedal zónou
+     * @param ccValue MIDI CC value (0-127)
+     * @param voiceManager Pointer na VoiceManager
+     *
+     * - ccValue < DAMPER_HALF_MIN: dampery plně tlumí (release = uživatelský)
+     * - half-pedal zóna: release se prodlužuje podle zdvihu damperu
+     * - ccValue ≥ 64 (ccValueToPedalState): VoiceManager drží noty (sustain pedal down)
+     */
+    void processDamper(uint8_t ccValue, VoiceManager* voiceManager);
+
+    /**
+     * @brief Sostenuto pedal (CC66)
+     * @param ccValue MIDI CC value (≤63 = up, ≥64 = down)
+     * @param voiceManager Pointer na VoiceManager
+     * @note Při uvolnění pošle odložené note-off pro zachycené noty
+     */
+    void processSostenuto(uint8_t ccValue, VoiceManager* voiceManager);
+
+    /**
+     * @brief Soft pedal / una corda (CC67)
+     * @param ccValue MIDI CC value (≤63 = up, ≥64 = down)
+     * @note Ovlivňuje pouze následující Note On (stejně jako u klavíru)
+     */
+    void processSoftPedal(uint8_t ccValue);
+
+    // ========================================================================
+    // Configuration
+    // ========================================================================
+
+    /**
+     * @brief Nastaví počet velocity vrstev aktuální banky (pro una corda posun)
+     * @param velocityLayerCount Počet vrstev (1-8)
+     */
+    void setVelocityLayerCount(int velocityLayerCount);
+
+    /**
+     * @brief Nastaví master gain a zapíše ho do všech voices včetně una corda útlumu
+     * @param masterGainMIDI Master gain 0-127
+     * @param voiceManager Pointer na VoiceManager
+     * @note Jediné místo, které zapisuje Voice::setMasterGain (volá ParameterManager při změně)
+     */
+    void setMasterGainMIDI(uint8_t masterGainMIDI, VoiceManager* voiceManager);
+
+    /**
+     * @brief Nastaví uživatelský release (z parametru) a aplikuje damper škálování
+     * @param releaseMIDI Release 0-127 z ParameterManager
+     * @param voiceManager Pointer na VoiceManager
+     */
+    void setUserReleaseMIDI(uint8_t releaseMIDI, VoiceManager* voiceManager);
+
+    /**
+     * @brief Nastaví release-trigger pool aktuální banky
+     * @param pool Pointer na pool (nullptr = banka nemá release samply)
+     */
+    void setReleaseTriggerPool(ReleaseTriggerPool* pool) { releasePool_ = pool; }
+
+    /**
+     * @brief Po výměně VoiceManageru: zruší zachycené noty, stav pedálů ponechá
+     * @param voiceManager Nový VoiceManager - dostane aktuální damper, release a gain
+     *
+     * Pedály mohou být fyzicky sešlápnuté i během výměny banky, jejich stav
+     * se proto nenuluje, ale znovu se zapíše do nového VoiceManageru.
+     */
+    void reset(VoiceManager* voiceManager);
+
+    // ========================================================================
+    // State Queries
+    // ========================================================================
+
+    bool isSostenutoDown() const { return sostenutoDown_; }
+    bool isSoftPedalDown() const { return softPedalDown_; }
+    bool isDamperHeld() const { return damperHeld_; }
+    uint8_t getDamperValue() const { return damperValue_; }
+
+    /**
+     * @brief Efektivní release po damper škálování
+     * @param userReleaseMIDI Uživatelský release 0-127
+     * @param damperValue CC64 hodnota 0-127
+     * @return Release 0-127 (≥ userReleaseMIDI)
+     */
+    static uint8_t computeDamperReleaseMIDI(uint8_t userReleaseMIDI, uint8_t damperValue);
+
+private:
+    NoteMask keysDown_;          ///< Fyzicky stisknuté klávesy
+    NoteMask sostenutoLatched_;  ///< Noty zachycené při sešlápnutí sostenuta
+    NoteMask pendingNoteOff_;    ///< Zachycené noty, jejichž klávesa už byla uvolněna
+    NoteMask damperSustained_;   ///< Noty uvolněné při drženém damperu (release trigger čeká)
+    NoteMask softStruck_;        ///< Noty zahrané s una corda (voice má ztlumený gain)
+
+    bool sostenutoDown_ = false;
+    bool softPedalDown_ = false;
+
+    uint8_t damperValue_ = 0;           ///< Poslední CC64 hodnota
+    bool damperHeld_ = false;           ///< Stav předaný do VoiceManager::setSustainPedalMIDI
+    uint8_t userReleaseMIDI_ = 4;       ///< Release z parametru (viz ParameterManager)
+    uint8_t appliedReleaseMIDI_ = 4;    ///< Release naposledy poslaný do VoiceManageru
+
+    static constexpr uint8_t RELEASE_NOT_APPLIED = 0xFF;  ///< Vynutí zápis release (nový VoiceManager)
+
+    int velocityLayerCount_ = 8;
+    uint8_t masterGainMIDI_ = 100;
+
+    ReleaseTriggerPool* releasePool_ = nullptr;  ///< Nevlastní - vlastní IthacaPluginProcessor
+
+    /**
+     * @brief Spustí release trigger, nebo ho odloží dokud damper drží notu
+     */
+    void releaseKey(uint8_t midiNote);
+
+    /**
+     * @brief Pošle efektivní release do VoiceManageru, pouze při změně o DAMPER_RELEASE_STEP
+     *        (krajní hodnoty vždy) - plynulý pohyb pedálu nezapisuje 128 voices na každé CC
+     */
+    void applyDamperRelease(VoiceManager* voiceManager);
+
+    /**
+     * @brief Zapíše master gain jedné noty (master gain × una corda útlum)
+     */
+    void applyVoiceGain(uint8_t midiNote, VoiceManager* voiceManager) const;
+
+    /**
+     * @brief Velocity po una corda posunu o jednu vrstvu dolů
+     */
+    uint8_t applySoftPedalVelocity(uint8_t velocity) const;
+};
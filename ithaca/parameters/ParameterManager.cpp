@@ -4,6 +4,8 @@
  */
 
 #include "ithaca/parameters/ParameterManager.h"
+#include "ithaca/midi/PedalProcessor.h"
+#include "ithaca/config/IthacaConfig.h"
 #include "ithaca-core/sampler/voice_manager.h"
 #include "ithaca-core/sampler/core_logger.h"
 #include <algorithm>
@@ -45,6 +47,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterManager::createPara
     // BBE Bass Boost (0-127, default 8 = ~6%)
     parameters.push_back(createMidiParameter("bbeBassBoost", "BBE Bass Boost", 8.0f));
 
+    // True Peak Limiter (on/off, default z ITHACA_TRUE_PEAK_LIMITER)
+    // Zpracovává ho procesor za VoiceManagerem, ne IthacaCore
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID("truePeakLimiter", 1), "True Peak Limiter", ITHACA_TRUE_PEAK_LIMITER != 0));
+
     return { parameters.begin(), parameters.end() };
 }
 
@@ -63,6 +70,7 @@ bool ParameterManager::initializeParameterPointers(juce::AudioProcessorValueTree
     stereoFieldParam_ = parameters.getRawParameterValue("stereoField");
     bbeDefinitionParam_ = parameters.getRawParameterValue("bbeDefinition");
     bbeBassBoostParam_ = parameters.getRawParameterValue("bbeBassBoost");
+    truePeakLimiterParam_ = parameters.getRawParameterValue("truePeakLimiter");
 
     // Zkontroluj zda byly všechny parametry nalezeny
     bool allValid = areParametersValid();
@@ -84,7 +92,7 @@ bool ParameterManager::initializeParameterPointers(juce::AudioProcessorValueTree
 
 // ===== RT-SAFE PARAMETER UPDATES =====
 
-void ParameterManager::updateSamplerParametersRTSafe(VoiceManager* voiceManager)
+void ParameterManager::updateSamplerParametersRTSafe(VoiceManager* voiceManager, PedalProcessor* pedals)
 {
     // Early exit pokud VoiceManager není dostupný
     if (!voiceManager || !areParametersValid()) {
@@ -98,10 +106,14 @@ void ParameterManager::updateSamplerParametersRTSafe(VoiceManager* voiceManager)
         uint8_t currentGain = getCurrentMasterGain();
         if (currentGain != lastMasterGain_) {
             lastMasterGain_ = currentGain;
-            for (int i = 0; i < 128; ++i) {
-                auto& voice = voiceManager->getVoiceMIDI(static_cast<uint8_t>(i));
-                float gain = currentGain / 127.0f;
-                voice.setMasterGain(gain);
+            if (pedals) {
+                pedals->setMasterGainMIDI(currentGain, voiceManager); // + una corda útlum
+            } else {
+                for (int i = 0; i < 128; ++i) {
+                    auto& voice = voiceManager->getVoiceMIDI(static_cast<uint8_t>(i));
+                    float gain = currentGain / 127.0f;
+                    voice.setMasterGain(gain);
+                }
             }
         }
     }
@@ -129,7 +141,11 @@ void ParameterManager::updateSamplerParametersRTSafe(VoiceManager* voiceManager)
         uint8_t currentRelease = getCurrentRelease();
         if (currentRelease != lastRelease_) {
             lastRelease_ = currentRelease;
-            voiceManager->setAllVoicesReleaseMIDI(currentRelease); // RT-safe
+            if (pedals) {
+                pedals->setUserReleaseMIDI(currentRelease, voiceManager); // + half-pedal
+            } else {
+                voiceManager->setAllVoicesReleaseMIDI(currentRelease); // RT-safe
+            }
         }
     }
     
@@ -241,6 +257,11 @@ uint8_t ParameterManager::getCurrentBBEBassBoost() const
     return bbeBassBoostParam_ ? convertToMidiValue(bbeBassBoostParam_->load()) : 8;
 }
 
+bool ParameterManager::isTruePeakLimiterEnabled() const
+{
+    return truePeakLimiterParam_ ? truePeakLimiterParam_->load() >= 0.5f : ITHACA_TRUE_PEAK_LIMITER != 0;
+}
+
 // ===== VALIDATION =====
 
 bool ParameterManager::areParametersValid() const
@@ -254,7 +275,8 @@ bool ParameterManager::areParametersValid() const
            lfoPanDepthParam_ != nullptr &&
            stereoFieldParam_ != nullptr &&
            bbeDefinitionParam_ != nullptr &&
-           bbeBassBoostParam_ != nullptr;
+           bbeBassBoostParam_ != nullptr &&
+           truePeakLimiterParam_ != nullptr;
 }
 
 // ===== HELPER METHODS =====
@@ -11,6 +11,7 @@
 // Forward declarations
 class VoiceManager;
 class Logger;
+class PedalProcessor;
 
 /**
  * @class ParameterManager
@@ -31,7 +32,7 @@ public:
     
     /**
      * @brief Vytvoří kompletní parameter layout pro ValueTreeState
-     * @return JUCE ParameterLayout se všemi 7 parametry
+     * @return JUCE ParameterLayout se všemi 11 parametry
      * 
      * Parametry:
      * - masterGain: 0-127, default 100
@@ -41,6 +42,10 @@ public:
      * - sustainLevel: 0-127, default 127
      * - lfoPanSpeed: 0-127, default 0
      * - lfoPanDepth: 0-127, default 0
+     * - stereoField: 0-127, default 0
+     * - bbeDefinition: 0-127, default 32
+     * - bbeBassBoost: 0-127, default 8
+     * - truePeakLimiter: on/off, default ITHACA_TRUE_PEAK_LIMITER
      */
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
@@ -58,12 +63,14 @@ public:
     /**
      * @brief RT-safe update všech parametrů do VoiceManager
      * @param voiceManager Pointer na VoiceManager (může být nullptr)
-     * @param logger Reference na Logger pro non-RT parametry
+     * @param pedals Pointer na PedalProcessor (volitelný) - release a master gain pak
+     *               prochází half-pedal škálováním a una corda útlumem místo
+     *               přímého zápisu do VoiceManageru
      * 
      * @note Volána z processBlock() - musí být RT-safe
      * @note Konvertuje GUI hodnoty na MIDI formát (0-127)
      */
-    void updateSamplerParametersRTSafe(VoiceManager* voiceManager);
+    void updateSamplerParametersRTSafe(VoiceManager* voiceManager, PedalProcessor* pedals = nullptr);
     
     // ===== PARAMETER ACCESS =====
     
@@ -127,6 +134,13 @@ public:
      */
     uint8_t getCurrentBBEBassBoost() const;
 
+    /**
+     * @brief Je zapnutý true-peak limiter na výstupu?
+     * @return true pokud má procesor limiter aplikovat
+     * @note RT-safe, čte se v processBlock() i v message threadu (latence)
+     */
+    bool isTruePeakLimiterEnabled() const;
+
     // ===== VALIDATION =====
     
     /**
@@ -149,6 +163,7 @@ private:
     std::atomic<float>* stereoFieldParam_ = nullptr;
     std::atomic<float>* bbeDefinitionParam_ = nullptr;
     std::atomic<float>* bbeBassBoostParam_ = nullptr;
+    std::atomic<float>* truePeakLimiterParam_ = nullptr;
     
     // ===== CHANGE DETECTION =====
     // Cached hodnoty pro detekci změn - eliminuje zbytečné VoiceManager volání
@@ -0,0 +1,134 @@
+/**
+ * @file LatencyHistogramTests.cpp
+ * @brief LatencyHistogram - bucket mapping, percentiles, window rotation, reset
+ */
+
+#include "TestHelpers.h"
+
+#include "ithaca/audio/LatencyHistogram.h"
+
+namespace {
+
+void testBucketBoundsContainValue()
+{
+    // Every value must fall inside [upperBound(index - 1), upperBound(index))
+    bool contained = true;
+    bool monotonic = true;
+    int previousIndex = 0;
+
+    for (uint32_t value = 0; value < (1u << 20); ++value) {
+        const int index = LatencyHistogram::bucketIndex(value);
+        const uint32_t upper = LatencyHistogram::bucketUpperBound(index);
+        const uint32_t lower = index > 0 ? LatencyHistogram::bucketUpperBound(index - 1) : 0;
+
+        contained = contained && value >= lower && value < upper;
+        monotonic = monotonic && index >= previousIndex;
+        previousIndex = index;
+    }
+
+    ITHACA_CHECK(contained);
+    ITHACA_CHECK(monotonic);
+}
+
+void testLinearRegionAndOctaveStart()
+{
+    for (uint32_t value = 0; value < LatencyHistogram::SUB_BUCKETS; ++value) {
+        ITHACA_CHECK(LatencyHistogram::bucketIndex(value) == static_cast<int>(value));
+    }
+
+    // 8-15 µs: one bucket per microsecond, 16 µs starts buckets two wide
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(8) == 8);
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(15) == 15);
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(16) == 16);
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(17) == 16);
+    ITHACA_CHECK(LatencyHistogram::bucketUpperBound(16) == 18);
+}
+
+void testRelativeErrorBound()
+{
+    // Bucket width / lower bound <= 1 / SUB_BUCKETS above the linear region
+    bool bounded = true;
+    for (int index = LatencyHistogram::SUB_BUCKETS; index < LatencyHistogram::NUM_BUCKETS; ++index) {
+        const double lower = LatencyHistogram::bucketUpperBound(index - 1);
+        const double upper = LatencyHistogram::bucketUpperBound(index);
+        bounded = bounded && (upper - lower) / lower <= 1.0 / LatencyHistogram::SUB_BUCKETS + 1.0e-12;
+    }
+    ITHACA_CHECK(bounded);
+}
+
+void testSaturation()
+{
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(0xFFFFFFFFu) == LatencyHistogram::NUM_BUCKETS - 1);
+    ITHACA_CHECK(LatencyHistogram::bucketIndex(1u << 30) == LatencyHistogram::NUM_BUCKETS - 1);
+}
+
+void testPercentiles()
+{
+    LatencyHistogram histogram(100000);
+    for (uint32_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+
+    const auto total = histogram.getPercentiles(LatencyHistogram::Scope::Total);
+    ITHACA_CHECK(total.count == 1000);
+    ITHACA_CHECK_NEAR(total.maxMs, 1.0, 1.0e-9);
+    ITHACA_CHECK_NEAR(total.p50Ms, 0.5, 0.5 / LatencyHistogram::SUB_BUCKETS);
+    ITHACA_CHECK_NEAR(total.p95Ms, 0.95, 0.95 / LatencyHistogram::SUB_BUCKETS);
+    ITHACA_CHECK_NEAR(total.p99Ms, 0.99, 0.99 / LatencyHistogram::SUB_BUCKETS);
+    ITHACA_CHECK(total.p999Ms <= total.maxMs);
+    ITHACA_CHECK(total.p50Ms <= total.p95Ms && total.p95Ms <= total.p99Ms);
+
+    const auto empty = LatencyHistogram(10).getPercentiles(LatencyHistogram::Scope::Total);
+    ITHACA_CHECK(empty.count == 0);
+    ITHACA_CHECK(empty.p99Ms == 0.0);
+}
+
+void testWindowRotation()
+{
+    LatencyHistogram histogram(10);
+
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(5000);     // Old spike, rotated out after two windows
+    }
+    for (int i = 0; i < 20; ++i) {
+        histogram.record(100);
+    }
+
+    const auto window = histogram.getPercentiles(LatencyHistogram::Scope::Window);
+    ITHACA_CHECK(window.count == 20);
+    ITHACA_CHECK_NEAR(histogram.getWindowMaxMs(), 0.1, 1.0e-9);
+
+    const auto total = histogram.getPercentiles(LatencyHistogram::Scope::Total);
+    ITHACA_CHECK(total.count == 30);
+    ITHACA_CHECK_NEAR(total.maxMs, 5.0, 1.0e-9);
+}
+
+void testResetAppliedOnNextRecord()
+{
+    LatencyHistogram histogram(10);
+    for (int i = 0; i < 50; ++i) {
+        histogram.record(2000);
+    }
+
+    histogram.reset();
+    histogram.record(300);
+
+    const auto total = histogram.getPercentiles(LatencyHistogram::Scope::Total);
+    ITHACA_CHECK(total.count == 1);
+    ITHACA_CHECK_NEAR(total.maxMs, 0.3, 1.0e-9);
+    ITHACA_CHECK(histogram.getPercentiles(LatencyHistogram::Scope::Window).count == 1);
+}
+
+} // namespace
+
+int main()
+{
+    testBucketBoundsContainValue();
+    testLinearRegionAndOctaveStart();
+    testRelativeErrorBound();
+    testSaturation();
+    testPercentiles();
+    testWindowRotation();
+    testResetAppliedOnNextRecord();
+    return IthacaTests::finish("LatencyHistogramTests");
+}
@@ -0,0 +1,98 @@
+/**
+ * @file NoteMaskTests.cpp
+ * @brief NoteMask (PedalProcessor.h) - set/reset/test and ordered iteration
+ */
+
+#include "TestHelpers.h"
+
+#include "ithaca/midi/PedalProcessor.h"
+
+#include <vector>
+
+namespace {
+
+void testEmptyMask()
+{
+    NoteMask mask;
+    ITHACA_CHECK(!mask.any());
+
+    int calls = 0;
+    mask.forEach([&](uint8_t) { ++calls; });
+    ITHACA_CHECK(calls == 0);
+}
+
+void testSetResetAcrossWordBoundary()
+{
+    NoteMask mask;
+    mask.set(0);
+    mask.set(63);
+    mask.set(64);
+    mask.set(127);
+
+    ITHACA_CHECK(mask.any());
+    ITHACA_CHECK(mask.test(0));
+    ITHACA_CHECK(mask.test(63));
+    ITHACA_CHECK(mask.test(64));
+    ITHACA_CHECK(mask.test(127));
+    ITHACA_CHECK(!mask.test(1));
+    ITHACA_CHECK(!mask.test(62));
+    ITHACA_CHECK(!mask.test(65));
+
+    mask.reset(63);
+    ITHACA_CHECK(!mask.test(63));
+    ITHACA_CHECK(mask.test(64));
+
+    // Reset nenastaveného bitu nic nemění
+    mask.reset(10);
+    ITHACA_CHECK(mask.test(0));
+
+    mask.clear();
+    ITHACA_CHECK(!mask.any());
+    ITHACA_CHECK(!mask.test(127));
+}
+
+void testForEachIsAscending()
+{
+    NoteMask mask;
+    const uint8_t notes[] = { 108, 21, 64, 63, 0, 127, 60 };
+    for (uint8_t note : notes) {
+        mask.set(note);
+    }
+
+    std::vector<uint8_t> visited;
+    mask.forEach([&](uint8_t note) { visited.push_back(note); });
+
+    const std::vector<uint8_t> expected = { 0, 21, 60, 63, 64, 108, 127 };
+    ITHACA_CHECK(visited == expected);
+}
+
+void testAllNotes()
+{
+    NoteMask mask;
+    for (int note = 0; note < 128; ++note) {
+        mask.set(static_cast<uint8_t>(note));
+    }
+
+    int count = 0;
+    int expectedNote = 0;
+    bool ordered = true;
+    mask.forEach([&](uint8_t note) {
+        ordered = ordered && (note == expectedNote);
+        ++expectedNote;
+        ++count;
+    });
+
+    ITHACA_CHECK(count == 128);
+    ITHACA_CHECK(ordered);
+}
+
+} // namespace
+
+int main()
+{
+    testEmptyMask();
+    testSetResetAcrossWordBoundary();
+    testForEachIsAscending();
+    testAllNotes();
+    return IthacaTests::finish("NoteMaskTests");
+}
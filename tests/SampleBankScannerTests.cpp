@@ -0,0 +1,80 @@
+/**
+ * @file SampleBankScannerTests.cpp
+ * @brief SampleBankScanner - bank file name parsing and resident size estimate
+ */
+
+#include "TestHelpers.h"
+
+#include "ithaca/audio/SampleBankScanner.h"
+#include "ithaca/config/IthacaConfig.h"
+
+namespace {
+
+bool parses(const char* fileName, int expectedNote, int expectedLayer)
+{
+    int note = -1;
+    int layer = -1;
+    return SampleBankScanner::parseFileName(juce::String(fileName), note, layer) &&
+           note == expectedNote && layer == expectedLayer;
+}
+
+bool rejects(const char* fileName)
+{
+    int note = -1;
+    int layer = -1;
+    return !SampleBankScanner::parseFileName(juce::String(fileName), note, layer);
+}
+
+void testValidNames()
+{
+    ITHACA_CHECK(parses("21_1.wav", 21, 1));
+    ITHACA_CHECK(parses("108_8.wav", 108, 8));
+    ITHACA_CHECK(parses("60_3.WAV", 60, 3));
+    ITHACA_CHECK(parses("060_03.wav", 60, 3));
+}
+
+void testInvalidNames()
+{
+    ITHACA_CHECK(rejects("instrument-definition.json"));
+    ITHACA_CHECK(rejects("60.wav"));            // No layer
+    ITHACA_CHECK(rejects("_1.wav"));            // No note
+    ITHACA_CHECK(rejects("60_.wav"));           // Empty layer
+    ITHACA_CHECK(rejects("60_0.wav"));          // Layers start at 1
+    ITHACA_CHECK(rejects("60_a.wav"));
+    ITHACA_CHECK(rejects("C4_1.wav"));
+    ITHACA_CHECK(rejects("60_1_release.wav"));
+    ITHACA_CHECK(rejects("60-1.wav"));
+}
+
+void testNoteRange()
+{
+    ITHACA_CHECK(parses("0_1.wav", 0, 1) == (ITHACA_MIDI_NOTE_MIN <= 0));
+    ITHACA_CHECK(rejects("128_1.wav"));
+    ITHACA_CHECK(rejects("999_1.wav"));
+}
+
+void testResidentEstimate()
+{
+    // Stereo float32 at the target rate
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(48000, 48000.0, 48000) == 48000 * 2 * 4);
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(44100, 44100.0, 48000) == 48000 * 2 * 4);
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(96000, 96000.0, 48000) == 48000 * 2 * 4);
+
+    // Resampled length rounds up
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(1, 44100.0, 48000) == 2 * 2 * 4);
+
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(0, 44100.0, 48000) == 0);
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(1000, 0.0, 48000) == 0);
+    ITHACA_CHECK(SampleBankScanner::estimateResidentBytes(1000, 44100.0, 0) == 0);
+}
+
+} // namespace
+
+int main()
+{
+    testValidNames();
+    testInvalidNames();
+    testNoteRange();
+    testResidentEstimate();
+    return IthacaTests::finish("SampleBankScannerTests");
+}
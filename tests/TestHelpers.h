@@ -0,0 +1,45 @@
+/**
+ * @file TestHelpers.h
+ * @brief Minimal check macros for the plugin-side unit tests
+ *
+ * Each test executable counts failed checks and returns the count from
+ * main(), so ctest reports any non-zero result as a failure.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+
+namespace IthacaTests {
+
+inline int& failureCount()
+{
+    static int failures = 0;
+    return failures;
+}
+
+inline void reportFailure(const char* file, int line, const char* expression)
+{
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    ++failureCount();
+}
+
+/**
+ * @brief Prints the summary line and returns the process exit code
+ */
+inline int finish(const char* suiteName)
+{
+    const int failures = failureCount();
+    std::printf("%s: %s (%d failed checks)\n", suiteName,
+                failures == 0 ? "PASSED" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}
+
+} // namespace IthacaTests
+
+#define ITHACA_CHECK(expression) \
+    do { if (!(expression)) IthacaTests::reportFailure(__FILE__, __LINE__, #expression); } while (false)
+
+#define ITHACA_CHECK_NEAR(actual, expected, tolerance) \
+    ITHACA_CHECK(std::abs((actual) - (expected)) <= (tolerance))
@@ -0,0 +1,180 @@
+/**
+ * @file TruePeakLimiterTests.cpp
+ * @brief TruePeakLimiter - latency, inter-sample peak ceiling, transparency, release, reset
+ */
+
+#include "TestHelpers.h"
+
+#include "ithaca/audio/TruePeakLimiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+constexpr double PI = 3.14159265358979323846;
+constexpr int BLOCK = 512;
+
+const float CEILING = static_cast<float>(std::pow(10.0, Constants::Audio::TruePeak::CEILING_DB / 20.0));
+
+std::vector<float> sine(int length, double frequency, double amplitude, double phase)
+{
+    std::vector<float> signal(static_cast<size_t>(length));
+    for (int i = 0; i < length; ++i) {
+        signal[static_cast<size_t>(i)] = static_cast<float>(amplitude * std::sin(2.0 * PI * frequency / SAMPLE_RATE * i + phase));
+    }
+    return signal;
+}
+
+void processInBlocks(TruePeakLimiter& limiter, std::vector<float>& left, std::vector<float>& right)
+{
+    const int length = static_cast<int>(left.size());
+    for (int offset = 0; offset < length; offset += BLOCK) {
+        limiter.process(left.data() + offset, right.data() + offset, std::min(BLOCK, length - offset));
+    }
+}
+
+/**
+ * @brief Reconstructed peak between samples (8x windowed-sinc interpolation)
+ */
+double truePeak(const std::vector<float>& signal, int from, int to)
+{
+    constexpr int HALF_TAPS = 32;
+    double peak = 0.0;
+    for (int i = std::max(from, HALF_TAPS); i < std::min(to, static_cast<int>(signal.size()) - HALF_TAPS); ++i) {
+        for (int fraction = 0; fraction < 8; ++fraction) {
+            const double t = i + fraction / 8.0;
+            double value = 0.0;
+            for (int k = -HALF_TAPS; k <= HALF_TAPS; ++k) {
+                const double x = t - (i + k);
+                const double sinc = x == 0.0 ? 1.0 : std::sin(PI * x) / (PI * x);
+                const double window = 0.5 + 0.5 * std::cos(PI * k / (HALF_TAPS + 1.0));
+                value += signal[static_cast<size_t>(i + k)] * sinc * window;
+            }
+            peak = std::max(peak, std::abs(value));
+        }
+    }
+    return peak;
+}
+
+void testLatency()
+{
+    TruePeakLimiter limiter;
+    limiter.prepare(SAMPLE_RATE);
+
+    const int expected = static_cast<int>(std::lround(Constants::Audio::TruePeak::LOOKAHEAD_MS * SAMPLE_RATE / 1000.0))
+                       + TruePeakLimiter::TAPS_PER_PHASE / 2;
+    ITHACA_CHECK(limiter.getLatencySamples() == expected);
+
+    // Impulse comes out exactly getLatencySamples() later
+    std::vector<float> left(1024, 0.0f);
+    std::vector<float> right(1024, 0.0f);
+    left[10] = 0.25f;
+    processInBlocks(limiter, left, right);
+
+    const auto peakAt = std::max_element(left.begin(), left.end(),
+                                         [](float a, float b) { return std::abs(a) < std::abs(b); }) - left.begin();
+    ITHACA_CHECK(peakAt == 10 + limiter.getLatencySamples());
+    ITHACA_CHECK_NEAR(left[static_cast<size_t>(peakAt)], 0.25f, 1.0e-6f);
+}
+
+void testInterSamplePeaksAreCaught()
+{
+    // Near fs/4 with a 45 degree phase the samples miss the crests by up to half a sample,
+    // so the sample peak reads ~0.7 x amplitude while the waveform reaches full amplitude
+    TruePeakLimiter limiter;
+    limiter.prepare(SAMPLE_RATE);
+
+    const int length = 24000;
+    auto left = sine(length, 11025.0, 1.6, PI / 4.0);
+    auto right = left;
+    processInBlocks(limiter, left, right);
+
+    const double peak = truePeak(left, 4000, length);
+    ITHACA_CHECK(peak <= CEILING * 1.01);
+    ITHACA_CHECK(peak >= CEILING * 0.9);    // Limited, not over-attenuated
+}
+
+void testTransparentBelowCeiling()
+{
+    TruePeakLimiter limiter;
+    limiter.prepare(SAMPLE_RATE);
+
+    const int length = 9600;
+    const auto input = sine(length, 1000.0, 0.5, 0.3);
+    auto left = input;
+    auto right = input;
+    processInBlocks(limiter, left, right);
+
+    const int latency = limiter.getLatencySamples();
+    double maxError = 0.0;
+    for (int i = latency; i < length; ++i) {
+        maxError = std::max(maxError, static_cast<double>(std::abs(left[static_cast<size_t>(i)] -
+                                                                    input[static_cast<size_t>(i - latency)])));
+    }
+    ITHACA_CHECK(maxError < 1.0e-6);
+}
+
+void testReleaseRecovers()
+{
+    TruePeakLimiter limiter;
+    limiter.prepare(SAMPLE_RATE);
+
+    const int loud = 4800;
+    const int length = loud + 48000;
+    auto input = sine(length, 440.0, 0.3, 0.0);
+    for (int i = 0; i < loud; ++i) {
+        input[static_cast<size_t>(i)] *= 5.0f;  // 1.5 peak, then back to 0.3
+    }
+
+    auto left = input;
+    auto right = input;
+    processInBlocks(limiter, left, right);
+
+    // Half a second later (10 release time constants) the gain is back to unity
+    const int latency = limiter.getLatencySamples();
+    double maxError = 0.0;
+    for (int i = length - 4800; i < length; ++i) {
+        maxError = std::max(maxError, static_cast<double>(std::abs(left[static_cast<size_t>(i)] -
+                                                                    input[static_cast<size_t>(i - latency)])));
+    }
+    ITHACA_CHECK(maxError < 1.0e-3);
+}
+
+void testResetClearsState()
+{
+    TruePeakLimiter limiter;
+    limiter.prepare(SAMPLE_RATE);
+
+    auto left = sine(2048, 440.0, 2.0, 0.0);
+    auto right = left;
+    processInBlocks(limiter, left, right);
+
+    limiter.reset();
+
+    // No leftover audio in the delay line and no leftover gain reduction
+    std::vector<float> silenceL(256, 0.0f);
+    std::vector<float> silenceR(256, 0.0f);
+    limiter.process(silenceL.data(), silenceR.data(), 256);
+    ITHACA_CHECK(*std::max_element(silenceL.begin(), silenceL.end()) == 0.0f);
+
+    std::vector<float> impulseL(256, 0.0f);
+    std::vector<float> impulseR(256, 0.0f);
+    impulseL[0] = 0.5f;
+    limiter.process(impulseL.data(), impulseR.data(), 256);
+    ITHACA_CHECK_NEAR(impulseL[static_cast<size_t>(limiter.getLatencySamples())], 0.5f, 1.0e-6f);
+}
+
+} // namespace
+
+int main()
+{
+    testLatency();
+    testInterSamplePeaksAreCaught();
+    testTransparentBelowCeiling();
+    testReleaseRecovers();
+    testResetClearsState();
+    return IthacaTests::finish("TruePeakLimiterTests");
+}
@@ -0,0 +1,221 @@
+/**
+ * @file XrunDetectorTests.cpp
+ * @brief XrunDetector - late/missed callbacks, budget overruns, bursts, offline, reset
+ */
+
+#include "TestHelpers.h"
+
+#include "ithaca/audio/XrunDetector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr double SAMPLE_RATE = 48000.0;
+constexpr int BLOCK = 512;
+constexpr double PERIOD_NS = BLOCK * 1.0e9 / SAMPLE_RATE;
+constexpr int WARMUP = Constants::Performance::Xruns::WARMUP_CALLBACKS;
+
+/**
+ * @brief Drives the detector with a synthetic callback clock
+ */
+struct Host {
+    XrunDetector detector;
+    Clock::time_point start = Clock::now();
+    double wallNs = 0.0;
+
+    Host() { detector.setAudioSettings(SAMPLE_RATE, BLOCK); }
+
+    void callback(int numSamples = BLOCK, int64_t processingNs = 100000)
+    {
+        detector.onCallbackStart(start + std::chrono::nanoseconds(static_cast<int64_t>(wallNs)), numSamples);
+        detector.onCallbackEnd(processingNs);
+        wallNs += numSamples * 1.0e9 / SAMPLE_RATE;
+    }
+
+    void run(int callbacks)
+    {
+        for (int i = 0; i < callbacks; ++i) {
+            callback();
+        }
+    }
+
+    int eventCount() const
+    {
+        XrunDetector::Event events[XrunDetector::EVENT_RING_SIZE];
+        return detector.getRecentEvents(events, XrunDetector::EVENT_RING_SIZE);
+    }
+};
+
+void testSteadyCallbacksAreClean()
+{
+    Host host;
+    host.run(2000);
+
+    const auto counters = host.detector.getCounters();
+    ITHACA_CHECK(counters.callbacks == 2000);
+    ITHACA_CHECK(counters.lateCallbacks == 0);
+    ITHACA_CHECK(counters.missedCallbacks == 0);
+    ITHACA_CHECK(counters.budgetOverruns == 0);
+    ITHACA_CHECK(host.eventCount() == 0);
+}
+
+void testLateCallback()
+{
+    Host host;
+    host.run(WARMUP + 100);
+
+    host.wallNs += PERIOD_NS * 0.7;     // Above LATE_THRESHOLD, below one period
+    host.run(100);
+
+    const auto counters = host.detector.getCounters();
+    ITHACA_CHECK(counters.lateCallbacks == 1);
+    ITHACA_CHECK(counters.missedCallbacks == 0);
+    ITHACA_CHECK_NEAR(counters.maxLatenessMs, PERIOD_NS * 0.7 / 1.0e6, 0.01);
+
+    XrunDetector::Event events[4];
+    ITHACA_CHECK(host.detector.getRecentEvents(events, 4) == 1);
+    ITHACA_CHECK(events[0].type == XrunDetector::Type::LateCallback);
+}
+
+void testMissedCallbacks()
+{
+    Host host;
+    host.run(WARMUP + 100);
+
+    host.wallNs += PERIOD_NS * 2.2;     // Two whole periods lost
+    host.run(100);
+
+    const auto counters = host.detector.getCounters();
+    ITHACA_CHECK(counters.missedCallbacks == 2);
+    ITHACA_CHECK(counters.lateCallbacks == 0);
+
+    XrunDetector::Event events[4];
+    ITHACA_CHECK(host.detector.getRecentEvents(events, 4) == 1);
+    ITHACA_CHECK(events[0].type == XrunDetector::Type::MissedCallback);
+    ITHACA_CHECK(events[0].missedCallbacks == 2);
+}
+
+void testJitterBelowThresholdIsIgnored()
+{
+    Host host;
+    host.run(WARMUP + 100);
+
+    host.wallNs += PERIOD_NS * 0.3;     // Below LATE_THRESHOLD
+    host.run(100);
+
+    ITHACA_CHECK(host.detector.getCounters().lateCallbacks == 0);
+    ITHACA_CHECK(host.eventCount() == 0);
+}
+
+void testBurstyHostIsClean()
+{
+    // Device buffer twice the block: two callbacks back to back, then a gap
+    Host host;
+    for (int i = 0; i < 1000; ++i) {
+        host.callback(BLOCK);
+        host.wallNs -= PERIOD_NS - 20000.0;
+        host.callback(BLOCK);
+        host.wallNs += PERIOD_NS - 20000.0;
+    }
+
+    const auto counters = host.detector.getCounters();
+    ITHACA_CHECK(counters.lateCallbacks == 0);
+    ITHACA_CHECK(counters.missedCallbacks == 0);
+}
+
+void testWarmupSuppressesEvents()
+{
+    Host host;
+    host.run(4);
+    host.wallNs += PERIOD_NS * 3.0;     // Host pre-fill / settling
+    host.run(WARMUP);
+
+    ITHACA_CHECK(host.detector.getCounters().missedCallbacks == 0);
+    ITHACA_CHECK(host.eventCount() == 0);
+}
+
+void testBudgetOverrun()
+{
+    Host host;
+    host.run(10);
+
+    const auto blockNs = static_cast<int64_t>(PERIOD_NS);
+    host.detector.onCallbackStart(host.start + std::chrono::nanoseconds(static_cast<int64_t>(host.wallNs)), BLOCK);
+    ITHACA_CHECK(host.detector.onCallbackEnd(blockNs * 2));
+    host.wallNs += PERIOD_NS;
+
+    host.detector.onCallbackStart(host.start + std::chrono::nanoseconds(static_cast<int64_t>(host.wallNs)), BLOCK);
+    ITHACA_CHECK(!host.detector.onCallbackEnd(blockNs / 2));
+
+    ITHACA_CHECK(host.detector.getCounters().budgetOverruns == 1);
+
+    XrunDetector::Event events[4];
+    ITHACA_CHECK(host.detector.getRecentEvents(events, 4) == 1);
+    ITHACA_CHECK(events[0].type == XrunDetector::Type::BudgetExceeded);
+}
+
+void testNonRealtimeCountsOnly()
+{
+    Host host;
+    host.detector.setNonRealtime(true);
+    host.run(WARMUP + 10);
+    host.wallNs += PERIOD_NS * 10.0;
+    host.callback(BLOCK, static_cast<int64_t>(PERIOD_NS * 5.0));
+
+    const auto counters = host.detector.getCounters();
+    ITHACA_CHECK(counters.callbacks == static_cast<uint64_t>(WARMUP + 11));
+    ITHACA_CHECK(counters.missedCallbacks == 0);
+    ITHACA_CHECK(counters.budgetOverruns == 0);
+    ITHACA_CHECK(host.eventCount() == 0);
+}
+
+void testResetClearsCountersAndEvents()
+{
+    Host host;
+    host.run(WARMUP + 100);
+    host.wallNs += PERIOD_NS * 2.2;
+    host.run(10);
+    ITHACA_CHECK(host.eventCount() == 1);
+
+    host.detector.reset();
+    ITHACA_CHECK(host.detector.getCounters().missedCallbacks == 0);
+
+    host.callback();    // Ring reset is applied by the writer
+    ITHACA_CHECK(host.eventCount() == 0);
+    ITHACA_CHECK(host.detector.getCounters().callbacks == 1);
+}
+
+void testEventRingKeepsNewest()
+{
+    Host host;
+    host.run(WARMUP + 10);
+
+    const int overruns = XrunDetector::EVENT_RING_SIZE + 10;
+    for (int i = 0; i < overruns; ++i) {
+        host.callback(BLOCK, static_cast<int64_t>(PERIOD_NS * 2.0));
+    }
+
+    XrunDetector::Event events[XrunDetector::EVENT_RING_SIZE];
+    const int count = host.detector.getRecentEvents(events, XrunDetector::EVENT_RING_SIZE);
+    ITHACA_CHECK(count == XrunDetector::EVENT_RING_SIZE);
+    ITHACA_CHECK(events[count - 1].blockIndex > events[0].blockIndex);
+    ITHACA_CHECK(host.detector.getCounters().budgetOverruns == static_cast<uint64_t>(overruns));
+}
+
+} // namespace
+
+int main()
+{
+    testSteadyCallbacksAreClean();
+    testLateCallback();
+    testMissedCallbacks();
+    testJitterBelowThresholdIsIgnored();
+    testBurstyHostIsClean();
+    testWarmupSuppressesEvents();
+    testBudgetOverrun();
+    testNonRealtimeCountsOnly();
+    testResetClearsCountersAndEvents();
+    testEventRingKeepsNewest();
+    return IthacaTests::finish("XrunDetectorTests");
+}